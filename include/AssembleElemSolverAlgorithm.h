@@ -111,6 +111,7 @@ public:
             for (int simdElemIndex = 0; simdElemIndex < numSimdElems; ++simdElemIndex) {
               stk::mesh::Entity element = b[bktIndex * simdLen + simdElemIndex];
               const auto elemIndex = ngpMesh.fast_mesh_index(element);
+              smdata.elemEntities[simdElemIndex] = element;
               smdata.ngpElemNodes[simdElemIndex] =
                 ngpMesh.get_nodes(entityRank, elemIndex);
               fill_pre_req_data(
@@ -66,7 +66,8 @@ public:
     Realm &realm,
     stk::mesh::Part *part,
     EquationSystem *eqSystem, std::vector<int>& grid_dims_,
-    std::vector<int>& horiz_bcs_, double z_sample_);
+    std::vector<int>& horiz_bcs_, double z_sample_,
+    bool single_rank_fft_ = false);
   virtual ~AssembleMomentumEdgeABLTopBC();
   virtual void initialize_connectivity();
 
@@ -77,7 +78,10 @@ public:
   /** Function to initialize static data on the first call.  It discovers
     * the computational box size, the distance between the sampling plane
     * and the upper boundary, forms lists of the sampling plane and upper 
-    * boundary plane node ids, and intitializes the FFT templates.
+    * boundary plane node ids, and intitializes the FFT templates.  With
+    * the single rank transform only the transform rank holds the global
+    * index maps and FFT plans; every other rank keeps the maps of the nodes
+    * it owns.
     */
   virtual void initialize();
 
@@ -156,6 +160,18 @@ public:
   double xL_, yL_, deltaZ_, zSample_;
   int nBC_, nXInflow_, nYInflow_, horizBCType_;
   bool needToInitialize_;
+
+  /** Single rank transform: the sampling plane is gathered to transformRank_
+    * only, which solves the potential flow problem and scatters back the
+    * upper boundary values owned by each rank (indexMapBCGlobal_ holds the
+    * boundary indices of all ranks, bcDistrib_ and bcDispl_ the number and
+    * offset of the velocity values sent to each rank).  Otherwise every
+    * rank gathers the full plane and repeats the transforms.
+    */
+  bool singleRankFFT_;
+  int transformRank_;
+  std::vector<int> indexMapBCGlobal_, bcDistrib_, bcDispl_;
+  bool havePlans_;
   fftw_plan planFourier2dF_, planFourier2dB_, planSinx_, planCosx_,
             planFourierxF_, planFourierxB_,   planSiny_, planCosy_,
             planFourieryF_, planFourieryB_;
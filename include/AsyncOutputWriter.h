@@ -0,0 +1,104 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+
+#ifndef AsyncOutputWriter_h
+#define AsyncOutputWriter_h
+
+#include <stk_util/parallel/Parallel.hpp>
+
+#include <future>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class FieldBase;
+}
+namespace io {
+class StkMeshIoBroker;
+}
+}
+
+namespace Ioss {
+class PropertyManager;
+}
+
+namespace sierra {
+namespace nalu {
+
+class IoMirrorMesh;
+
+/** Overlap Exodus results output with the time integration
+ *
+ *  The output is written from an IoMirrorMesh, a private copy of the io
+ *  parts of the realm mesh that holds the coordinates and the output fields.
+ *  At an output step the field data is copied into the copy on the calling
+ *  thread and the database write is queued on BackgroundIo, through a
+ *  dedicated stk::io::StkMeshIoBroker that works on a duplicate of the realm
+ *  communicator. The writer never touches the realm mesh, so the solver may
+ *  keep modifying it. At most one write is in flight; the next snapshot and
+ *  destruction wait for it to complete. The copy does not follow a
+ *  repartitioning of the realm mesh; the realm closes the output and creates
+ *  a new one after a rebalance.
+ */
+class AsyncOutputWriter
+{
+public:
+  explicit AsyncOutputWriter(stk::mesh::BulkData& bulk);
+  ~AsyncOutputWriter();
+
+  AsyncOutputWriter(const AsyncOutputWriter&) = delete;
+  AsyncOutputWriter& operator=(const AsyncOutputWriter&) = delete;
+
+  //! Select the named fields for output
+  void register_fields(const std::set<std::string>& fieldNames);
+
+  //! Copy the mesh, create the output database and add the fields to it
+  void create_output(
+    const std::string& dbName,
+    Ioss::PropertyManager& properties,
+    const bool useNodesetForPartNodesFields);
+
+  //! Complete the in-flight write and drop the copy and database, e.g.,
+  //! before the realm mesh is rebalanced; create_output may follow again
+  void close_output();
+
+  //! Snapshot the output fields and queue the database write for this step
+  void write(const double currentTime);
+
+  //! Block until the in-flight write, if any, has completed
+  void wait();
+
+  //! Accumulated time spent in background writes
+  double overlapped_time() const { return timerOverlapped_; }
+
+private:
+  stk::mesh::BulkData& bulk_;
+  stk::ParallelMachine comm_;
+  std::vector<stk::mesh::FieldBase*> fields_;
+  std::unique_ptr<IoMirrorMesh> mirror_;
+  std::unique_ptr<stk::io::StkMeshIoBroker> ioBroker_;
+
+  size_t resultsFileIndex_{0};
+  bool meshWritten_{false};
+
+  std::future<double> pending_;
+  double timerOverlapped_{0.0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -0,0 +1,74 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+
+#ifndef BackgroundIo_h
+#define BackgroundIo_h
+
+#include <future>
+#include <memory>
+#include <utility>
+
+namespace sierra {
+namespace nalu {
+
+/** Ordered execution of database accesses off the main thread
+ *
+ *  Tasks run one at a time, in the order in which they were submitted, on a
+ *  thread other than the main thread. Every rank submits the same tasks in
+ *  the same order, so the collectives of the tasks match across ranks
+ *  without any locking; each task communicates on its own duplicate of the
+ *  realm communicator. Tasks must only touch data that the main thread leaves
+ *  alone until their future is collected, e.g. an IoMirrorMesh.
+ *
+ *  NetCDF is not thread-safe; database access on the main thread has to
+ *  drain() the queue first.
+ */
+class BackgroundIo
+{
+public:
+  static BackgroundIo& self();
+
+  //! MPI must provide MPI_THREAD_MULTIPLE for tasks to run off the main thread
+  static bool threading_supported();
+
+  //! Queue a task behind all previously submitted ones; main thread only
+  template <typename Task>
+  std::future<decltype(std::declval<Task>()())> submit(Task&& task)
+  {
+    using Result = decltype(std::declval<Task>()());
+    auto job = std::make_shared<std::packaged_task<Result()>>(std::forward<Task>(task));
+    std::future<Result> result = job->get_future();
+
+    // failures are reported through the future of the task, not its
+    // successor; the predecessor is released once done so the chain stays short
+    std::shared_future<void> previous = tail_;
+    tail_ = std::async(std::launch::async, [previous, job]() mutable {
+      if (previous.valid())
+        previous.wait();
+      previous = std::shared_future<void>();
+      (*job)();
+    }).share();
+    return result;
+  }
+
+  //! Block until every submitted task has completed
+  void drain();
+
+private:
+  BackgroundIo() = default;
+
+  std::shared_future<void> tail_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
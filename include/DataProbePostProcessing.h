@@ -18,6 +18,7 @@
 #include <vector>
 #include <utility>
 #include <memory>
+#include <future>
 
 // stk_mesh/base/fem
 #include <stk_mesh/base/Selector.hpp>
@@ -42,7 +43,9 @@ namespace stk {
 namespace sierra{
 namespace nalu{
 
+class PointSampler;
 class Realm;
+class TimeResolvedLidar;
 class Transfer;
 class Transfers;
 
@@ -86,6 +89,9 @@ public:
   std::vector<std::vector<double>>  offsetSpacings_;
   std::vector<std::string> onlyOutputField_;
 
+  // first point of each probe in the point sampler of the specification
+  std::vector<size_t> pointOffset_;
+
 };
 
 class DataProbeSpecInfo {
@@ -119,12 +125,18 @@ public:
 
   void add_external_data_probe_spec_info(DataProbeSpecInfo* dpsInfo);
 
+  // scanning lidar sampled every time step along its current beam
+  void add_time_resolved_lidar(const YAML::Node &node);
+
   // setup part creation and nodal field registration (before populate_mesh())
   void setup();
 
   // setup part creation and nodal field registration (after populate_mesh())
   void initialize();
 
+  // search the probe transfers again after the realm was rebalanced
+  void reinitialize();
+
   void register_field(
     const std::string fieldName,
     const int fieldSize,
@@ -143,12 +155,38 @@ public:
   // optionally create an exodus database
   void create_exodus();
 
+  // optionally set up the gathered layout for binary line-of-site output
+  void create_binary_layout();
+
+  // sample without probe nodes; one point sampler per specification
+  void create_point_samplers();
+  void sample_points();
+
+  // coordinates of the first numPoints points of a probe
+  void probe_coordinates(
+    const DataProbeInfo *probeInfo,
+    const int probe,
+    const size_t numPoints,
+    std::vector<double> &coords) const;
+
   // populate nodal field and output norms (if appropriate)
   void execute();
 
   // output to a file
   void provide_output_txt(const double currentTime);
   void provide_output_exodus(const double currentTime);
+  void provide_output_binary(const double currentTime);
+
+  // write buffered binary samples in the background (rank 0 only)
+  void flush_binary();
+
+  // points of a probe held on this rank and their sampled data
+  size_t num_probe_points(const DataProbeInfo *probeInfo, const int probe) const;
+  const double *probe_point_coordinates(
+    const size_t spec, const DataProbeInfo *probeInfo, const int probe, const size_t point) const;
+  const double *probe_point_field(
+    const size_t spec, const DataProbeInfo *probeInfo, const int probe, const size_t point,
+    const size_t field) const;
 
   
   // provide the inactive selector
@@ -191,9 +229,45 @@ private:
   bool useExo_{false};
   bool useText_{false};
   bool enablePerfTiming_{false};
+  bool usePointSampler_{false};
   std::string exoName_;
   size_t fileIndex_;
   size_t precisionvar_;
+
+  // binary output; all line-of-site probes are gathered to rank 0 and every
+  // binaryBufferSteps_ output steps are written to a single file
+  struct BinaryProbe {
+    size_t spec_;
+    DataProbeInfo *probeInfo_;
+    int probe_;
+    int owner_;
+    int numPoints_;
+    size_t recvOffset_;
+  };
+
+  bool useBinary_{false};
+  std::string binaryName_{"data_probes"};
+  size_t binaryBufferSteps_{10};
+  std::vector<BinaryProbe> binaryProbes_;
+  std::vector<int> binaryNumComponents_;
+  std::vector<int> binaryRecvCounts_;
+  std::vector<int> binaryRecvDispls_;
+  int binaryNumDim_{3};
+  size_t binaryStepSize_{0};
+  int binaryFirstStep_{0};
+  std::vector<double> binaryTimes_;
+  std::vector<double> binaryBuffer_;
+  std::future<void> binaryWriter_;
+
+  // coordinates and probe fields of the node-based probes, [specification][field]
+  const stk::mesh::FieldBase *probeCoordinates_{nullptr};
+  std::vector<std::vector<const stk::mesh::FieldBase *>> probeFields_;
+
+  // mesh-free sampling; values are [specification][field][point*component]
+  std::vector<std::unique_ptr<PointSampler>> pointSamplers_;
+  std::vector<std::vector<std::vector<double>>> sampledFields_;
+
+  std::vector<std::unique_ptr<TimeResolvedLidar>> timeResolvedLidars_;
 };
 
 } // namespace nalu
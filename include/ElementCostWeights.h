@@ -0,0 +1,124 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+
+#ifndef ElementCostWeights_h
+#define ElementCostWeights_h
+
+#include <FieldTypeDef.h>
+
+#include <stk_balance/balanceUtils.hpp>
+#include <stk_mesh/base/BulkData.hpp>
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Part.hpp>
+
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+/** Estimated assembly cost of every element, used as the vertex weights of
+ *  the stk_balance graph
+ *
+ *  The cost of an element is the weight of its element block (1 unless
+ *  specified) plus an additional weight for each of its faces that lies on
+ *  one of the weighted boundary parts, e.g., wall function or non-conformal
+ *  interface faces. The costs are stored in an element field so that they
+ *  migrate with the elements and can be written to the output.
+ */
+class ElementCostWeights
+{
+public:
+  ElementCostWeights(stk::mesh::BulkData& bulk, ScalarFieldType& weights);
+
+  //! Cost of each element of the block `part`
+  void add_block_weight(const stk::mesh::Part& part, const double weight);
+
+  //! Additional cost of an element for each of its faces on `part`
+  void add_face_weight(const stk::mesh::Part& part, const double weight);
+
+  //! Fill the weight field for all local elements
+  void compute();
+
+  //! Sum of the weights of the locally owned elements
+  double local_cost() const;
+
+  const ScalarFieldType& weight_field() const { return weights_; }
+
+private:
+  stk::mesh::BulkData& bulk_;
+  ScalarFieldType& weights_;
+
+  std::vector<std::pair<const stk::mesh::Part*, double>> blockWeights_;
+  std::vector<std::pair<const stk::mesh::Part*, double>> faceWeights_;
+};
+
+/** stk_balance settings that read the graph vertex weights from the element
+ *  cost field
+ */
+class CostWeightedBalanceSettings : public stk::balance::GraphCreationSettings
+{
+public:
+  CostWeightedBalanceSettings(const ScalarFieldType& weights)
+    : weights_(weights)
+  {}
+
+  virtual bool areVertexWeightsProvidedViaFields() const override
+  { return true; }
+
+  virtual double getFieldVertexWeight(
+    const stk::mesh::BulkData&,
+    stk::mesh::Entity entity,
+    int = 0) const override
+  {
+    return *stk::mesh::field_data(weights_, entity);
+  }
+
+private:
+  const ScalarFieldType& weights_;
+};
+
+/** Measured assembly time of the solver algorithms, per mesh part
+ *
+ *  The time of an algorithm execution is shared between the parts it loops
+ *  over in proportion to their number of locally owned entities, i.e., the
+ *  sizes of the buckets it assembles. The cost per entity of a part, summed
+ *  over all ranks, can then be used as its block or face weight in
+ *  ElementCostWeights.
+ */
+class AssemblyCostTimers
+{
+public:
+  AssemblyCostTimers(const stk::mesh::BulkData& bulk);
+
+  //! Add the time spent by one execution of an algorithm over `parts`
+  void add_time(const stk::mesh::PartVector& parts, const double seconds);
+
+  //! Time per entity of each part over all ranks; zero for untimed parts
+  std::vector<double> cost_per_entity(const stk::mesh::PartVector& parts) const;
+
+  //! Remove the accumulated times
+  void reset() { time_.clear(); }
+
+private:
+  size_t num_owned_entities(const stk::mesh::Part& part) const;
+
+  const stk::mesh::BulkData& bulk_;
+
+  //! accumulated time keyed by part ordinal
+  std::map<unsigned, double> time_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -278,6 +278,7 @@ public:
   double maxLinearIterations_;
   double minLinearIterations_;
   int nonLinearIterationCount_;
+  double totalLinearIterations_;
   bool reportLinearIterations_;
   bool firstTimeStepSolve_;
   bool edgeNodalGradient_;
@@ -327,6 +328,11 @@ public:
   inline bool is_decoupled() const
   { return decoupledOverset_; }
 
+  /** Determine whether reinitialize_linear_system can keep the existing
+   *  linear system (graph, ID maps and solver) and only reset its values
+   */
+  bool reuse_linear_system() const;
+
   std::vector<Algorithm *> bcDataAlg_;
   std::vector<Algorithm *> bcDataMapAlg_;
   std::vector<Algorithm *> copyStateAlg_;
@@ -692,6 +692,9 @@ private:
 
   //! HYPRE solution vector
   mutable HYPRE_IJVector sln_;
+
+  //! Product of the matrix and the solution for the initial guess projection
+  mutable HYPRE_IJVector projectionWork_;
 };
 
 } // namespace nalu
@@ -0,0 +1,81 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+
+#ifndef InitialGuessProjection_h
+#define InitialGuessProjection_h
+
+#include <KokkosInterface.h>
+
+#include <mpi.h>
+
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+/** Initial guess from the projection onto previous solutions
+ *
+ *  Keeps up to `maxVectors` solutions x_k of earlier solves, orthonormal in
+ *  the energy norm of the system matrix, together with y_k = A x_k. The
+ *  initial guess for a new right-hand side b is its A-orthogonal projection
+ *  onto their span, x0 = sum_k (b, x_k) x_k (Fischer's method). The caller
+ *  provides the product A x of every new solution; once the basis is full it
+ *  restarts from the latest solution. The basis is only valid for the matrix
+ *  it was built with and has to be reset when the matrix changes. Intended
+ *  for symmetric positive definite systems such as the pressure Poisson
+ *  equation.
+ *
+ *  The vectors are the locally owned rows and live in device memory; each
+ *  call performs a single global reduction.
+ */
+class InitialGuessProjection
+{
+public:
+  InitialGuessProjection(MPI_Comm comm, const int maxVectors);
+
+  //! Forget all stored solutions
+  void reset();
+
+  //! Write the projected initial guess for `rhs` to `sln`; false if none
+  bool initial_guess(const double* rhs, double* sln, const size_t numRows);
+
+  //! Add the solution `sln` together with its product `ax` = A sln
+  void add_solution(const double* ax, const double* sln, const size_t numRows);
+
+  int num_vectors() const { return numVectors_; }
+  int max_vectors() const { return maxVectors_; }
+
+private:
+  using BasisView = Kokkos::View<double**, Kokkos::LayoutLeft, MemSpace>;
+
+  void resize(const size_t numRows);
+
+  //! Global inner products of `v` with the first `numVectors_` columns of `basis`
+  void inner_products(
+    const BasisView& basis,
+    const double* v,
+    const size_t numRows,
+    std::vector<double>& result,
+    const double* w = nullptr);
+
+  MPI_Comm comm_;
+  const int maxVectors_;
+  int numVectors_{0};
+
+  // basis x_k and images y_k = A x_k, one column per vector
+  BasisView x_;
+  BasisView y_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -16,6 +16,7 @@
 
 // standard c++
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 #include <stdint.h>
@@ -29,6 +30,7 @@ namespace sierra{
 namespace nalu{
 
 class Realms;
+class PrecursorInflowReader;
 
 class InputOutputInfo {
 
@@ -73,12 +75,17 @@ public:
   void advance_time_step() {}
   double populate_restart( double &timeStepNm1, int &timeStepCount);
   void populate_external_variables_from_input(const double currentTime);
+  void complete_pending_input();
+  void launch_pending_input();
  
   // internal calls
   void register_io_fields();
 
   // hold the field information
   std::vector<InputOutputInfo *> inputOutputFieldInfo_;
+
+  // optional read-ahead of the input variables
+  std::unique_ptr<PrecursorInflowReader> precursorReader_;
 };
 
 } // namespace nalu
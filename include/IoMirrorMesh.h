@@ -0,0 +1,110 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+
+#ifndef IoMirrorMesh_h
+#define IoMirrorMesh_h
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/EntityKey.hpp>
+#include <stk_mesh/base/Types.hpp>
+#include <stk_util/parallel/Parallel.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class FieldBase;
+class MetaData;
+}
+}
+
+namespace sierra {
+namespace nalu {
+
+/** Private copy of the io parts of a mesh for database access off the main thread
+ *
+ *  The locally owned elements of the io element blocks, the io side set sides
+ *  that are owned together with one of their elements, the io node sets and
+ *  the nodes of all of these are copied into a bulk data of their own on the
+ *  given communicator. Only the coordinates and the requested fields are
+ *  declared on the copy. A background task may then read or write the copy
+ *  through its own stk::io::StkMeshIoBroker while the solver keeps using and
+ *  modifying the source mesh; field values are exchanged with the source mesh
+ *  on the main thread by entity key while no such task is in flight.
+ *
+ *  The copy is built once and does not follow changes of the locally owned
+ *  entities of the source mesh, e.g. by rebalancing or adaptivity; its owner
+ *  has to replace it with a new copy after such a change.
+ */
+class IoMirrorMesh
+{
+public:
+  IoMirrorMesh(
+    const stk::mesh::BulkData& source,
+    stk::ParallelMachine comm,
+    const std::vector<stk::mesh::FieldBase*>& fields);
+  ~IoMirrorMesh();
+
+  IoMirrorMesh(const IoMirrorMesh&) = delete;
+  IoMirrorMesh& operator=(const IoMirrorMesh&) = delete;
+
+  stk::mesh::BulkData& bulk_data() { return *bulk_; }
+
+  //! Copy of a requested source field, or nullptr
+  stk::mesh::FieldBase* field(const stk::mesh::FieldBase& sourceField) const;
+
+  //! Entities of the copy that hold a field; fixed once constructed
+  const std::vector<stk::mesh::Entity>& entities(const stk::mesh::FieldBase& mirrorField) const;
+
+  //! Source entities matching entities(), or invalid ones; main thread only
+  const std::vector<stk::mesh::Entity>& source_entities(const stk::mesh::FieldBase& mirrorField);
+
+  //! Copy the coordinates and requested fields from the source mesh
+  void copy_from_source();
+
+private:
+  struct MirroredField
+  {
+    stk::mesh::FieldBase* source_;
+    stk::mesh::FieldBase* mirror_;
+    std::vector<stk::mesh::Entity> entities_;
+    std::vector<stk::mesh::EntityKey> keys_;
+    std::vector<stk::mesh::Entity> sourceEntities_;
+    size_t syncCount_;
+  };
+
+  void declare_parts();
+  void declare_field(stk::mesh::FieldBase& sourceField);
+  void populate();
+  void share_nodes();
+
+  stk::mesh::Part* mirror_part(const stk::mesh::Part& sourcePart) const;
+  void mirror_parts(const stk::mesh::Bucket& bucket, stk::mesh::PartVector& parts) const;
+  stk::mesh::Selector io_selector(const stk::mesh::EntityRank rank) const;
+
+  MirroredField& mirrored(const stk::mesh::FieldBase& mirrorField);
+  const MirroredField& mirrored(const stk::mesh::FieldBase& mirrorField) const;
+
+  const stk::mesh::BulkData& source_;
+  std::unique_ptr<stk::mesh::MetaData> meta_;
+  std::unique_ptr<stk::mesh::BulkData> bulk_;
+
+  //! copy of each source part by ordinal, nullptr for non-io parts
+  std::vector<stk::mesh::Part*> partMap_;
+  std::vector<MirroredField> mirroredFields_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -14,6 +14,7 @@
 
 #include <LinearSolverTypes.h>
 #include <LinearSolverConfig.h>
+#include <PreconditionerReusePolicy.h>
 
 #include <Kokkos_DefaultNode.hpp>
 #include <Tpetra_Details_DefaultTypes.hpp>
@@ -152,6 +153,9 @@ class LinearSolver
         config_(config),
         recomputePreconditioner_(config->recomputePreconditioner()),
         reusePreconditioner_(config->reusePreconditioner()),
+        reusePolicy_(
+          name, config->preconditionerReuseFactor(),
+          config->maxPreconditionerReuse()),
         timerPrecond_(0.0)
     {}
     virtual ~LinearSolver() {}
@@ -174,6 +178,8 @@ class LinearSolver
   LinearSolverConfig* config_;
   bool recomputePreconditioner_;
   bool reusePreconditioner_;
+  //! Adaptive reuse decisions when config_->adaptivePreconditionerReuse()
+  PreconditionerReusePolicy reusePolicy_;
   double timerPrecond_;
   bool activateMueLu_{false};
 
@@ -252,8 +258,16 @@ class TpetraLinearSolver : public LinearSolver
       return (config_->useSegregatedSolver() ? PT_TPETRA_SEGREGATED : PT_TPETRA);
     }
 
+  /** Measure convergence against the norm of the right-hand side, as for a
+   *  zero initial guess, so that a projected initial guess saves iterations
+   *
+   *  Only changes the parameters of this solver, not those of the other
+   *  equation systems sharing the solver block.
+   */
+    void use_rhs_residual_scaling();
+
   private:
-  //! The solver parameters
+  //! The solver parameters; a copy of the solver block parameters
     const Teuchos::RCP<Teuchos::ParameterList> params_;
 
   //! The preconditioner parameters
@@ -56,19 +56,54 @@ public:
   inline bool reusePreconditioner() const
   { return reusePreconditioner_; }
 
+  /** User flag to reuse the preconditioner while the linear iteration count
+   *  stays within preconditionerReuseFactor() times the count of the first
+   *  solve after the last setup (see PreconditionerReusePolicy)
+   */
+  inline bool adaptivePreconditionerReuse() const
+  { return adaptivePreconditionerReuse_; }
+
+  inline double preconditionerReuseFactor() const
+  { return preconditionerReuseFactor_; }
+
+  //! Maximum number of consecutive reuses; 0 for no limit
+  inline int maxPreconditionerReuse() const
+  { return maxPreconditionerReuse_; }
+
+  /** Number of previous solutions used to project the initial guess of each
+   *  solve (see InitialGuessProjection); 0 starts every solve from zero
+   */
+  inline int initialGuessProjection() const
+  { return initialGuessProjection_; }
+
   inline bool useSegregatedSolver() const
   { return useSegregatedSolver_; }
 
   /** User flag indicating whether equation systems must attempt to reuse linear
    *  system data structures even for cases with mesh motion.
    *
-   *  This option only affects decoupled overset system solves where the matrix
-   *  graph doesn't change, only the entries within the graph. This can be
-   *  controlled on a per-solver basis.
+   *  The linear system is reused for decoupled overset system solves, and for
+   *  any mesh motion (e.g., rigid rotation or translation) where the realm
+   *  detects that the matrix graph hasn't changed, only the entries within the
+   *  graph. This can be controlled on a per-solver basis.
    */
   inline bool reuseLinSysIfPossible() const
   { return reuseLinSysIfPossible_; }
 
+  /** User declaration that the matrix graph never changes during the
+   *  simulation; the linear system is always reused on mesh motion without
+   *  checking for mesh modifications.
+   */
+  inline bool staticLinSysGraph() const
+  { return staticLinSysGraph_; }
+
+  /** User flag to precompute the CSR locations of element node-pair
+   *  couplings so that element assembly scatters without searching the
+   *  matrix rows (Tpetra only).
+   */
+  inline bool useElementScatterMaps() const
+  { return useElementScatterMaps_; }
+
   std::string get_method() const
   {return method_;}
 
@@ -85,6 +120,9 @@ public:
   { return solverType_; }
 
 protected:
+  //! Parse the adaptive preconditioner reuse options common to all solvers
+  void load_adaptive_reuse(const YAML::Node&);
+
   std::string solverType_;
   std::string name_;
   std::string method_;
@@ -100,9 +138,15 @@ protected:
   bool recomputePreconditioner_{true};
   unsigned recomputePrecondFrequency_{1}; /* positive integer. Recompute precond before all solves */
   bool reusePreconditioner_{false};
+  bool adaptivePreconditionerReuse_{false};
+  double preconditionerReuseFactor_{1.5};
+  int maxPreconditionerReuse_{0};
+  int initialGuessProjection_{0};
   bool useSegregatedSolver_{false};
   bool writeMatrixFiles_{false};
   bool reuseLinSysIfPossible_{false};
+  bool staticLinSysGraph_{false};
+  bool useElementScatterMaps_{false};
 };
 
 class TpetraLinearSolverConfig : public LinearSolverConfig
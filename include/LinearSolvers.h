@@ -67,6 +67,7 @@ public:
   Simulation *parent();
 
   Teuchos::ParameterList get_solver_configuration(std::string);
+  Teuchos::ParameterList get_preconditioner_configuration(std::string);
 
   typedef std::map<std::string, LinearSolver *> SolverMap;
   typedef std::map<std::string, TpetraLinearSolverConfig *> SolverTpetraConfigMap;
@@ -13,6 +13,7 @@
 #define LinearSystem_h
 
 #include <LinearSolverTypes.h>
+#include <InitialGuessProjection.h>
 #include <KokkosInterface.h>
 
 #include <stk_mesh/base/Ngp.hpp>
@@ -65,6 +66,25 @@ public:
                           const SharedMemView<const double**,DeviceShmem> & lhs,
                           const char * trace_tag) = 0;
 
+  /** Sum element contributions when the owning mesh entity is known
+   *
+   *  Linear systems that have precomputed the CSR locations of the entity's
+   *  node-pair couplings can scatter directly into the matrix; the default
+   *  falls back to the search-based assembly above.
+   */
+  KOKKOS_FUNCTION
+  virtual void sum_into_entity(stk::mesh::Entity /* entity */,
+                               unsigned numEntities,
+                               const stk::mesh::NgpMesh::ConnectedNodes& entities,
+                               const SharedMemView<int*,DeviceShmem> & localIds,
+                               const SharedMemView<int*,DeviceShmem> & sortPermutation,
+                               const SharedMemView<const double*,DeviceShmem> & rhs,
+                               const SharedMemView<const double**,DeviceShmem> & lhs,
+                               const char * trace_tag)
+  {
+    (*this)(numEntities, entities, localIds, sortPermutation, rhs, lhs, trace_tag);
+  }
+
   virtual void free_device_pointer() = 0;
   virtual CoeffApplier* device_pointer() = 0;
   
@@ -191,6 +211,7 @@ public:
   bool useSegregatedSolver() const;
 
   EquationSystem* equationSystem() { return eqSys_; }
+  LinearSolver* linearSolver() { return linearSolver_; }
 
 protected:
   virtual void beginLinearSystemConstruction()=0;
@@ -201,6 +222,13 @@ protected:
   void sync_field(const stk::mesh::FieldBase *field);
   bool debug();
 
+  /** Forget the projected solutions if the matrix changed since the last solve
+   *
+   *  `matrixNorm` is the global Frobenius norm of the assembled matrix, which
+   *  serves as a fingerprint of its coefficients.
+   */
+  void check_initial_guess_matrix(const double matrixNorm);
+
   Realm &realm_;
   EquationSystem *eqSys_;
   bool inConstruction_;
@@ -216,6 +244,10 @@ protected:
   bool recomputePreconditioner_;
   bool reusePreconditioner_;
 
+  //! Projected initial guesses when the solver sets initial_guess_projection
+  std::unique_ptr<InitialGuessProjection> initialGuess_;
+  double initialGuessMatrixNorm_{0.0};
+
   std::unique_ptr<CoeffApplier> hostCoeffApplier;
   CoeffApplier* deviceCoeffApplier = nullptr;
 
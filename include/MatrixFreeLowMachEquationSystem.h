@@ -13,11 +13,13 @@
 #include "EquationSystem.h"
 #include "Kokkos_Array.hpp"
 
+#include "stk_mesh/base/Entity.hpp"
 #include "stk_mesh/base/Selector.hpp"
 
 #include <iosfwd>
 #include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace YAML {
@@ -92,10 +94,7 @@ public:
   virtual void register_abltop_bc(
     stk::mesh::Part*,
     const stk::topology&,
-    const ABLTopBoundaryConditionData&) final
-  {
-    throw std::runtime_error("abltop not implemented for matrix free");
-  }
+    const ABLTopBoundaryConditionData&) final;
 
   virtual void
   register_non_conformal_bc(stk::mesh::Part*, const stk::topology&) final
@@ -103,17 +102,12 @@ public:
     throw std::runtime_error("nonconformal not implemented for matrix free");
   }
 
-  virtual void register_overset_bc()
-  {
-    throw std::runtime_error("overset not implemented for matrix free");
-  }
+  virtual void register_overset_bc() final;
 
   virtual void register_surface_pp_algorithm(
-    const PostProcessingData&, stk::mesh::PartVector&) final
-  {
-    throw std::runtime_error(
-      "surface post-processing not implemented for matrix free");
-  }
+    const PostProcessingData&, stk::mesh::PartVector&) final;
+
+  void post_converged_work() final;
 
   void compute_filter_scale() const;
   void compute_body_force() const;
@@ -135,17 +129,21 @@ private:
 
   std::ostream& log();
   void validate_matrix_free_linear_solver_config();
-  void check_solver_configuration(std::string, std::string);
+  void check_solver_configuration(std::string, std::vector<std::string>);
   void copy_pressure_grad();
   void compute_provisional_velocity(Kokkos::Array<double, 3> gammas);
   void correct_velocity(double proj_time_scale);
   void initialize_solve_and_update();
   void sync_field_on_periodic_nodes(std::string name, int len) const;
-  void setup_and_compute_continuity_preconditioner();
+  void setup_and_compute_continuity_preconditioner(
+    const std::vector<stk::mesh::Entity>& constraint_nodes);
   void compute_courant_reynolds();
   void check_part_is_valid(const stk::mesh::Part*);
   void
   register_copy_state_algorithm(std::string, int dim, stk::mesh::Part& part);
+  void compute_surface_forces();
+  int compute_abltop_normal() const;
+  void update_overset_fringes(std::string name, int len);
 
   std::string get_muelu_xml_file_name();
 
@@ -153,9 +151,22 @@ private:
   stk::mesh::MetaData& meta_;
   stk::mesh::Selector interior_selector_;
   stk::mesh::Selector wall_selector_;
+  stk::mesh::Selector abltop_selector_;
+  bool has_abltop_{false};
+  bool has_overset_{false};
   std::unique_ptr<matrix_free::LowMachEquationUpdate> update_;
   std::unique_ptr<TpetraLinearSystem> precond_linsys_;
   bool initialized_{false};
+
+  // pressure and viscous force and their moment on a set of wall surfaces
+  struct SurfaceForceOutput
+  {
+    stk::mesh::Selector selector;
+    std::string file_name;
+    int frequency;
+    Kokkos::Array<double, 3> centroid;
+  };
+  std::vector<SurfaceForceOutput> surface_force_outputs_;
 };
 
 } // namespace nalu
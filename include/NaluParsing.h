@@ -192,6 +192,7 @@ struct ABLTopUserData : public UserData {
   std::vector<int> grid_dims_;
   std::vector<int> horiz_bcs_;
   double z_sample_;
+  bool single_rank_fft_{false};
 
   bool normalTemperatureGradientSpec_;
 
@@ -17,6 +17,7 @@
 //==============================================================================
 
 #include <master_element/MasterElement.h>
+#include <FieldTypeDef.h>
 
 // stk
 #include <stk_mesh/base/Part.hpp>
@@ -96,6 +97,9 @@ class NonConformalInfo {
   void provide_diagnosis();
   size_t error_check();
 
+  /* predict the opposing faces from the previous match; returns the number of misses */
+  size_t incremental_search();
+
   Realm &realm_;
   const std::string name_;
 
@@ -123,6 +127,9 @@ class NonConformalInfo {
   /* can we possibly reuse */
   bool canReuse_;
 
+  /* has a full search provided an opposing face for every gauss point */
+  bool hasOpposingFaces_;
+
   /* bounding box data types for stk_search */
   std::vector<boundingSphere>     boundingSphereVec_;
   std::vector<boundingElementBox> boundingFaceElementBoxVec_;
@@ -138,6 +145,13 @@ class NonConformalInfo {
                                  const std::vector<std::pair<theKey,theKey>> &searchKeyPair) const;
   void repeat_search_if_needed  (const std::vector<boundingSphere>           &boundingSphereVec,
                                  std::vector<std::pair<theKey,theKey>>       &searchKeyPair) const;
+  double opposing_face_distance (const DgInfo                                *dgInfo,
+                                 stk::mesh::Entity                           opposingFace,
+                                 const VectorFieldType                       &coordinates,
+                                 std::vector<double>                         &opposingIsoParCoords,
+                                 std::vector<double>                         &theElementCoords) const;
+  bool walk_to_opposing_face    (DgInfo                                      *dgInfo,
+                                 const VectorFieldType                       &coordinates);
 };
 
 } // end sierra namespace
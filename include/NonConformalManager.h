@@ -51,7 +51,8 @@ class NonConformalManager {
   NonConformalManager(
     Realm & realm,
     const bool ncAlgDetailedOutput,
-    const bool ncAlgCoincidentNodesErrorCheck);
+    const bool ncAlgCoincidentNodesErrorCheck,
+    const bool ncAlgIncrementalSearch = false);
 
   ~NonConformalManager();
 
@@ -60,6 +61,11 @@ class NonConformalManager {
   Realm &realm_;
   const bool ncAlgDetailedOutput_;
   const bool ncAlgCoincidentNodesErrorCheck_;
+  const bool ncAlgIncrementalSearch_;
+
+  /* steps served by the incremental search and full searches performed */
+  size_t numIncrementalSearches_;
+  size_t numFullSearches_;
 
   /* ghosting for all surface:block pair */
   stk::mesh::Ghosting *nonConformalGhosting_;
@@ -72,6 +78,8 @@ class NonConformalManager {
   private:
 
   void manage_ghosting(std::vector<stk::mesh::EntityKey>& recvGhostsToRemove);
+  void update_ghosted_coordinates();
+  bool incremental_search();
 };
 
 } // end nalu namespace
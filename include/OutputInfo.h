@@ -51,6 +51,7 @@ public:
   int outputStart_;
   bool outputNodeSet_; 
   int serializedIOGroupSize_;
+  bool asyncOutput_;
   bool hasOutputBlock_;
   bool hasRestartBlock_;
   bool activateRestart_;
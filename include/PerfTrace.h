@@ -0,0 +1,73 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+
+#ifndef PerfTrace_h
+#define PerfTrace_h
+
+#include <stk_util/parallel/Parallel.hpp>
+
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace YAML { class Node; }
+
+namespace sierra{
+namespace nalu{
+
+/** Per-timestep structured export of the realm and equation system timers
+ *
+ *  The timers held by Realm and EquationSystem accumulate over the run (and
+ *  are reset whenever the timer summary is printed). PerfTrace turns them
+ *  into per-step increments and writes one JSON object per traced step. By
+ *  default the increments are reduced to min/avg/max over ranks and written
+ *  by rank 0; with `per_rank` every rank writes its own raw values to
+ *  `<file_name>.<rank>`.
+ */
+class PerfTrace
+{
+public:
+  typedef std::vector<std::pair<std::string, double>> CounterVector;
+
+  PerfTrace(const std::string& realmName, stk::ParallelMachine comm);
+  ~PerfTrace();
+
+  void load(const YAML::Node& node);
+
+  //! Accumulate the increments since the last call; write every frequency_ steps
+  void record(
+    const int timeStepCount,
+    const double currentTime,
+    const CounterVector& counters);
+
+  std::string fileName_;
+  int frequency_;
+  bool perRank_;
+
+private:
+  void write_aggregated(const int timeStepCount, const double currentTime, const CounterVector& counters);
+  void write_per_rank(const int timeStepCount, const double currentTime, const CounterVector& counters);
+
+  const std::string realmName_;
+  stk::ParallelMachine comm_;
+  std::ofstream out_;
+
+  std::vector<double> lastValue_;
+  std::vector<double> increment_;
+  double lastWallTime_;
+  double wallIncrement_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -61,6 +61,9 @@ class PeriodicManager {
 
   void build_constraints();
 
+  // search the pairs again after the mesh was repartitioned
+  void rebuild_constraints();
+
   // holder for master += slave; slave = master
   void apply_constraints(
     stk::mesh::FieldBase *,
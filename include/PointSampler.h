@@ -0,0 +1,136 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+
+#ifndef PointSampler_h
+#define PointSampler_h
+
+#include <FieldTypeDef.h>
+#include <KokkosInterface.h>
+
+#include <stk_mesh/base/BulkData.hpp>
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Selector.hpp>
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+/** Interpolate nodal fields to an arbitrary cloud of points
+ *
+ *  The points are held in a Kokkos view and never become mesh entities. Each
+ *  point is located in a locally owned element of the source parts with a
+ *  coarse box search followed by the isoparametric inversion of the master
+ *  element; only the points found on a rank are exchanged, and when several
+ *  ranks find a point the closest element (lowest rank on ties) owns it. The
+ *  owning rank caches the element nodes and the shape function weights, so
+ *  that sampling a field is a single device kernel after which each value is
+ *  sent to the rank that writes the point.
+ *
+ *  The full search is repeated only when the bulk data was modified. After
+ *  mesh motion, or when the points are moved, a point that has left its
+ *  cached element first walks through the neighbouring elements; only the
+ *  points that are still lost are searched again. Points that a search
+ *  missed are cached as misses and only searched again after the mesh
+ *  moves, or once they move into the bounding box of the source elements.
+ */
+class PointSampler
+{
+public:
+  using PointView = Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::HostSpace>;
+
+  PointSampler(
+    stk::mesh::BulkData& bulk,
+    const stk::mesh::PartVector& fromParts,
+    const double searchTolerance = 1.0e-4,
+    const std::string& coordinatesName = "coordinates");
+
+  //! Replace the point cloud; nDim interleaved coordinates per point
+  void set_points(const std::vector<double>& coords);
+
+  //! Rank receiving the sampled values of each point; rank 0 by default
+  void set_destinations(const std::vector<int>& ranks);
+
+  //! Move the points of the current cloud; keeps the cached elements
+  void move_points(const std::vector<double>& coords);
+
+  //! Locate the points; reuses the cached elements when still valid
+  void locate(const bool meshMoved = false);
+
+  //! Interpolate a nodal field to every point; the interleaved values of a
+  //! point are only set on its destination rank and zero elsewhere
+  void sample(const stk::mesh::FieldBase& field, std::vector<double>& values);
+
+  size_t num_points() const { return points_.extent(0); }
+  const double* point(const size_t i) const { return &points_(i, 0); }
+
+  //! Number of points found in the source parts (all ranks)
+  size_t num_found() const { return numFound_; }
+
+  //! Whether point i was found in the source parts (all ranks)
+  bool found(const size_t i) const { return found_[i] != 0; }
+
+  //! Number of element searches performed
+  size_t num_searches() const { return numSearches_; }
+
+private:
+  void relocate(const bool meshMoved);
+  void update_global_box();
+  bool in_global_box(const size_t i) const;
+  bool walk(stk::mesh::Entity& elem, const double* pointCoord);
+  void search(const std::vector<size_t>& candidates);
+  void update_weights();
+  double weights(
+    const stk::mesh::Entity elem,
+    const double* pointCoord,
+    std::vector<double>& w);
+
+  stk::mesh::BulkData& bulk_;
+  stk::mesh::Selector fromSelector_;
+  const VectorFieldType* coordinates_{nullptr};
+  const int nDim_;
+  const double searchTolerance_;
+
+  PointView points_;
+  std::vector<int> destinations_;
+
+  // points found on any rank, points the last search missed; bounds of the
+  // local and of all source elements
+  std::vector<int> found_;
+  std::vector<int> missed_;
+  bool globalBoxValid_{false};
+  std::array<double, 3> globalMinCorner_{{0.0, 0.0, 0.0}};
+  std::array<double, 3> globalMaxCorner_{{0.0, 0.0, 0.0}};
+  bool localBoxValid_{false};
+  std::array<double, 3> localMinCorner_{{0.0, 0.0, 0.0}};
+  std::array<double, 3> localMaxCorner_{{0.0, 0.0, 0.0}};
+
+  // points owned by this rank and their element
+  std::vector<size_t> ownedPoints_;
+  std::vector<stk::mesh::Entity> ownedElems_;
+  int maxNodes_{0};
+
+  Kokkos::View<stk::mesh::FastMeshIndex**, Kokkos::LayoutRight, MemSpace> nodeIndex_;
+  Kokkos::View<double**, Kokkos::LayoutRight, MemSpace> weights_;
+
+  bool located_{false};
+  bool pointsMoved_{false};
+  size_t syncCount_{0};
+  size_t numFound_{0};
+  size_t numSearches_{0};
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
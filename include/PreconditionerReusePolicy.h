@@ -0,0 +1,61 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+
+#ifndef PreconditionerReusePolicy_h
+#define PreconditionerReusePolicy_h
+
+#include <string>
+
+namespace sierra{
+namespace nalu{
+
+/** Decide when a linear solver must set up its preconditioner again
+ *
+ *  The iteration count of the first solve after a preconditioner setup is the
+ *  baseline. Later solves reuse the preconditioner while their iteration
+ *  count stays within `iterationFactor` times the baseline (and, optionally,
+ *  for at most `maxReuse` solves); the solve after one that exceeded the limit
+ *  sets the preconditioner up again. Every decision is logged.
+ */
+class PreconditionerReusePolicy
+{
+public:
+  PreconditionerReusePolicy(
+    const std::string& name,
+    const double iterationFactor,
+    const int maxReuse);
+
+  //! Forget the baseline, e.g., when the linear system was rebuilt
+  void reset();
+
+  //! Whether the next solve must set up the preconditioner
+  bool setup_required() const { return setupRequired_; }
+
+  //! Record a solve; `freshSetup` if the preconditioner was set up for it
+  void record(const int iterations, const bool freshSetup);
+
+  int baseline_iterations() const { return baseline_; }
+  int num_reuses() const { return numReuses_; }
+
+private:
+  const std::string name_;
+  const double iterationFactor_;
+  const int maxReuse_;
+
+  int baseline_{0};
+  int numReuses_{0};
+  bool setupRequired_{true};
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
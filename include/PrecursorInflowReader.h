@@ -0,0 +1,154 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+
+#ifndef PrecursorInflowReader_h
+#define PrecursorInflowReader_h
+
+#include <stk_mesh/base/Types.hpp>
+#include <stk_util/parallel/Parallel.hpp>
+
+#include <deque>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace stk {
+namespace io {
+class StkMeshIoBroker;
+}
+}
+
+namespace YAML { class Node; }
+
+namespace sierra{
+namespace nalu{
+
+class IoMirrorMesh;
+
+/** Read-ahead reader for precursor inflow data of an external field provider
+ *
+ *  The input fields are read one database time step (plane) at a time into an
+ *  IoMirrorMesh, a private copy of the io parts of the realm mesh, and copied
+ *  into an in-memory ring buffer of `num_planes` planes. Once the realm fields
+ *  have been transferred, the planes following the current time interval are
+ *  read by a task queued on BackgroundIo, which only touches the copy, so the
+ *  realm mesh may be searched and modified while the read is in flight. The
+ *  realm fields are then filled by interpolating between the two buffered
+ *  planes bracketing the current time. The precursor may be split over
+ *  several time-sliced databases that share the mesh of the realm.
+ *
+ *  An update served from planes that were buffered, or whose background read
+ *  had completed, counts as a read-ahead hit; an update that had to wait for
+ *  a read counts as a miss.
+ */
+class PrecursorInflowReader
+{
+public:
+  explicit PrecursorInflowReader(const std::string& meshDbName);
+  ~PrecursorInflowReader();
+
+  PrecursorInflowReader(const PrecursorInflowReader&) = delete;
+  PrecursorInflowReader& operator=(const PrecursorInflowReader&) = delete;
+
+  void load(const YAML::Node& node);
+
+  //! Select the realm fields to read as (field name, database name)
+  void register_fields(
+    stk::mesh::BulkData& bulk,
+    const std::map<std::string, std::string>& varFromFileMap);
+
+  //! Open the databases and build the global time line; follows mesh creation
+  void initialize(
+    const bool interpolateInTime,
+    const double periodicTime,
+    const double restorationTime);
+
+  //! Fill the realm fields at the requested time from the ring buffer
+  double update(const double currentTime);
+
+  //! Start reading the planes following the last update in the background
+  void prefetch();
+
+  //! Complete the read in flight, if any
+  void wait();
+
+  //! Read-ahead statistics on this rank
+  size_t hits() const { return hits_; }
+  size_t misses() const { return misses_; }
+
+  int numPlanes_;
+  std::vector<std::string> dbNames_;
+
+private:
+  //! One database time step of every registered field
+  struct Plane
+  {
+    size_t index_;
+    std::vector<std::vector<double>> data_;
+  };
+
+  //! Location of a global time index in the list of databases
+  struct TimeLevel
+  {
+    double time_;
+    size_t db_;
+    int step_;
+  };
+
+  //! Realm field, its copy on the mirror mesh and the offset of each
+  //! entities() value of the copy within a plane
+  struct StagedField
+  {
+    stk::mesh::FieldBase* target_;
+    stk::mesh::FieldBase* stage_;
+    std::string dbName_;
+    std::vector<size_t> offsets_;
+  };
+
+  Plane read_plane(const size_t index);
+  std::vector<Plane> read_planes(const std::vector<size_t> indices);
+
+  bool has_plane(const size_t index) const;
+  const Plane& get_plane(const size_t index) const;
+  bool acquire_plane(const size_t index);
+  void collect_pending();
+  void retire(const size_t first);
+
+  stk::mesh::BulkData* bulk_{nullptr};
+  stk::ParallelMachine comm_;
+  std::unique_ptr<IoMirrorMesh> mirror_;
+  std::unique_ptr<stk::io::StkMeshIoBroker> ioBroker_;
+  std::vector<size_t> dbIndex_;
+
+  std::vector<StagedField> stagedFields_;
+  std::vector<TimeLevel> timeLine_;
+
+  bool interpolateInTime_{false};
+  double periodicTime_{0.0};
+  double restorationTime_{0.0};
+  bool threaded_{false};
+
+  std::deque<Plane> planes_;
+  size_t nextFirst_{0};
+  size_t nextLast_{0};
+  std::vector<size_t> pendingIndices_;
+  std::future<std::vector<Plane>> pending_;
+
+  size_t hits_{0};
+  size_t misses_{0};
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
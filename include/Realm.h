@@ -57,6 +57,9 @@ namespace nalu{
 
 class Algorithm;
 class AlgorithmDriver;
+class AssemblyCostTimers;
+class ElementCostWeights;
+class AsyncOutputWriter;
 class AuxFunctionAlgorithm;
 class GeometryAlgDriver;
 
@@ -67,6 +70,7 @@ class OutputInfo;
 class OversetManager;
 class PostProcessingInfo;
 class PeriodicManager;
+class PerfTrace;
 class Realms;
 class Simulation;
 class SolutionOptions;
@@ -144,13 +148,23 @@ class Realm {
   void makeSureNodesHaveValidTopology();
 
   void initialize_global_variables();
+  std::string assembly_cost_name(const stk::mesh::Part& part) const;
 
   void rebalance_mesh();
+  bool add_measured_cost_weights(ElementCostWeights& costWeights);
+  bool add_part_cost_weights(
+    ElementCostWeights& costWeights, const std::vector<double>& cost);
+  void cost_weighted_balance(ElementCostWeights& costWeights);
+  void periodic_rebalance();
+  void reinitialize_after_rebalance();
 
   void balance_nodes();
 
+  void setup_async_output();
   void create_output_mesh();
   void create_restart_mesh();
+  std::string database_name(const std::string& dbName) const;
+  void order_entities();
   void input_variables_from_mesh();
 
   void augment_output_variable_list(
@@ -170,6 +184,12 @@ class Realm {
   bool has_mesh_motion() const;
   bool has_mesh_deformation() const;
   bool does_mesh_move() const;
+
+  /** True if the linear system graphs built at the last (re)initialization
+   *  are still valid, i.e., the mesh has not been modified and there are no
+   *  non-conformal or coupled overset connections that change with motion
+   */
+  bool linsys_graph_unchanged() const { return linSysGraphUnchanged_; }
   bool has_non_matching_boundary_face_alg() const;
 
   // overset boundary condition requires elemental field registration
@@ -269,6 +289,9 @@ class Realm {
   virtual void boundary_data_to_state_data();
   virtual double populate_variables_from_input(const double currentTime);
   virtual void populate_external_variables_from_input(const double /* currentTime */) {}
+  // background reads of external variables may not overlap transfers from this realm
+  virtual void complete_pending_input() {}
+  virtual void launch_pending_input() {}
   virtual double populate_restart( double &timeStepNm1, int &timeStepCount);
   virtual void populate_derived_quantities();
   virtual void evaluate_properties();
@@ -294,6 +317,7 @@ class Realm {
   void check_job(bool get_node_count);
 
   void dump_simulation_time();
+  void provide_perf_trace();
   double provide_mean_norm();
 
   double get_hybrid_factor(
@@ -491,6 +515,10 @@ class Realm {
   bool hasOverset_;
   bool isExternalOverset_{false};
 
+  // mesh synchronization count when linear system graphs were last built
+  size_t linSysSyncCount_{0};
+  bool linSysGraphUnchanged_{false};
+
   // three type of transfer operations
   bool hasMultiPhysicsTransfer_;
   bool hasInitializationTransfer_;
@@ -530,10 +558,32 @@ class Realm {
   bool rebalanceMesh_{false};
   
   std::string rebalanceMethod_;
+
+  // element cost weights for the rebalance (see ElementCostWeights)
+  bool useRebalanceWeights_{false};
+  std::map<std::string, double> rebalanceBlockWeights_;
+  double wallFunctionFaceWeight_{0.0};
+  double nonConformalFaceWeight_{0.0};
+  std::vector<std::string> wallFunctionPartNames_;
+  std::vector<std::string> nonConformalPartNames_;
+  ScalarFieldType *rebalanceWeight_{nullptr};
+
+  // measured assembly cost per part, carried to the rebalance of a restart
+  bool measureAssemblyCost_{false};
+  stk::mesh::PartVector assemblyCostParts_;
+  std::unique_ptr<AssemblyCostTimers> assemblyCostTimers_;
+
+  // periodic rebalance with the measured cost; 0 rebalances only at startup
+  int rebalanceFrequency_{0};
+  // decompositions seen by the output databases, 1 until the first rebalance
+  int meshRevision_{1};
    
   // allow aura to be optional
   bool activateAura_;
 
+  // order nodes, edges and elements along a space filling curve
+  bool sortAlongSpaceFillingCurve_;
+
   // allow detailed output (memory) to be provided
   bool activateMemoryDiagnostic_;
 
@@ -628,6 +678,8 @@ class Realm {
 
   // tools
   std::unique_ptr<PromotedElementIO> promotionIO_; // mesh outputer
+  std::unique_ptr<AsyncOutputWriter> asyncOutputWriter_; // overlapped results output
+  std::unique_ptr<PerfTrace> perfTrace_; // per-timestep timer export
   std::vector<std::string> superTargetNames_;
 
   void setup_element_promotion(); // create super parts
@@ -645,6 +697,7 @@ class Realm {
   bool matrixFree_{false};
 
   Teuchos::ParameterList solver_parameters(std::string) const;
+  Teuchos::ParameterList solver_preconditioner_parameters(std::string) const;
 
   stk::mesh::PartVector allPeriodicInteractingParts_;
   stk::mesh::PartVector allNonConformalInteractingParts_;
@@ -55,6 +55,7 @@ struct SharedMemData {
     ~SharedMemData() = default;
 
     stk::mesh::NgpMesh::ConnectedNodes ngpElemNodes[simdLen];
+    stk::mesh::Entity elemEntities[simdLen];
     int numSimdElems;
 #ifdef KOKKOS_ENABLE_CUDA
     ScratchViews<DoubleType,TEAMHANDLETYPE,SHMEM>* prereqData[1];
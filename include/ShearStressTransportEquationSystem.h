@@ -28,6 +28,8 @@ class EquationSystems;
 class AlgorithmDriver;
 class TurbKineticEnergyEquationSystem;
 class SpecificDissipationRateEquationSystem;
+class TpetraComponentLinearSystem;
+class LinearSolver;
 
 class ShearStressTransportEquationSystem : public EquationSystem
 {
@@ -39,6 +41,7 @@ public:
   virtual void load(const YAML::Node&);
 
   virtual void initialize();
+  virtual void reinitialize_linear_system();
 
   virtual void register_nodal_fields(stk::mesh::Part* part);
 
@@ -51,6 +54,10 @@ public:
 
   virtual void solve_and_update();
 
+  //! One Newton step of k and omega together in the block system linsys_
+  void assemble_and_solve_coupled();
+  void create_coupled_linear_system(LinearSolver* tkeSolver, LinearSolver* sdrSolver);
+
   void initial_work();
   virtual void post_external_data_transfer_work();
   virtual void post_iter_work();
@@ -81,6 +88,12 @@ public:
 
   bool resetAMSAverages_;
 
+  // k and omega assembled into one block system with two dofs per node
+  bool coupledSolve_{false};
+  TpetraComponentLinearSystem* tkeComponent_{nullptr};
+  TpetraComponentLinearSystem* sdrComponent_{nullptr};
+  GenericFieldType* coupledDelta_{nullptr};
+
   const double tkeMinValue_{1.0e-8};
   const double sdrMinValue_{1.0e-8};
 };
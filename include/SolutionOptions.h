@@ -135,6 +135,7 @@ public:
   bool ncAlgCoincidentNodesErrorCheck_;
   bool ncAlgCurrentNormal_;
   bool ncAlgPngPenalty_;
+  bool ncAlgIncrementalSearch_;
   bool cvfemShiftMdot_;
   bool cvfemReducedSensPoisson_;
   double inputVariablesRestorationTime_;
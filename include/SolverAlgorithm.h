@@ -48,6 +48,20 @@ struct NGPApplyCoeff
     SharedMemView<double**,DeviceShmem> & lhs,
     const char *trace_tag) const;
 
+  /** Variant used by element assembly, allowing the linear system to use
+   *  precomputed scatter locations for the given entity
+   */
+  KOKKOS_FUNCTION
+  void operator()(
+    stk::mesh::Entity entity,
+    unsigned numMeshobjs,
+    const stk::mesh::NgpMesh::ConnectedNodes& symMeshobjs,
+    const SharedMemView<int*,DeviceShmem> & scratchIds,
+    const SharedMemView<int*,DeviceShmem> & sortPermutation,
+    SharedMemView<double*,DeviceShmem> & rhs,
+    SharedMemView<double**,DeviceShmem> & lhs,
+    const char *trace_tag) const;
+
   KOKKOS_FUNCTION
   void extract_diagonal(
     const unsigned nEntities,
@@ -35,6 +35,9 @@ public:
   virtual void pre_work();
   virtual void execute();
   virtual void post_work();
+
+  // execute an algorithm; timed per part when measuring the assembly cost
+  void execute_algorithm(SolverAlgorithm *alg);
   
   // different types of algorithms... interior/flux; constraints and dirichlet
   std::map<std::string, SolverAlgorithm *> solverAlgorithmMap_;
@@ -0,0 +1,86 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+
+#ifndef SpaceFillingCurveSorter_h
+#define SpaceFillingCurveSorter_h
+
+#include <FieldTypeDef.h>
+
+#include <stk_mesh/base/BulkData.hpp>
+#include <stk_mesh/base/MetaData.hpp>
+#include <stk_mesh/base/EntitySorterBase.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Morton (Z-order) keys of the centroids of `entities`
+ *
+ *  The centroids are quantized to 21 bits per direction within their
+ *  bounding box and the bits are interleaved, so that entities with close
+ *  keys are close in space.
+ */
+std::vector<uint64_t> morton_keys(
+  const stk::mesh::BulkData& bulk,
+  const VectorFieldType& coordinates,
+  const stk::mesh::EntityVector& entities);
+
+//! Reorder `entities` along the Morton curve through their centroids
+void sort_along_space_filling_curve(
+  const stk::mesh::BulkData& bulk,
+  const VectorFieldType& coordinates,
+  stk::mesh::EntityVector& entities);
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// SpaceFillingCurveSorter
+//=============================================================================
+/**
+ * * @par Description:
+ * - Class that sorts the nodes, edges and elements of each bucket along a
+ *   space filling curve.
+ *
+ * @par Design Considerations:
+ * - Edge and element loops gather nodal data; ordering the entities by
+ *   location makes neighbouring loop iterations touch neighbouring memory.
+ * - Faces keep the exposed face ordinal sort of the consolidated bc approach
+ *   when requested (see EntityExposedFaceSorter).
+ * - The sorter is applied once by Realm::initialize_prolog; STK sorts the
+ *   partitions touched by a later modification cycle by id again.
+ */
+//=============================================================================
+
+class SpaceFillingCurveSorter : public stk::mesh::EntitySorterBase {
+
+  public:
+
+  SpaceFillingCurveSorter(
+    const VectorFieldType& coordinates,
+    const bool sortExposedFaces)
+    : coordinates_(coordinates),
+      sortExposedFaces_(sortExposedFaces)
+  {}
+
+  virtual void sort(stk::mesh::BulkData &bulk, stk::mesh::EntityVector& entityVector) const;
+
+  private:
+
+  const VectorFieldType& coordinates_;
+  const bool sortExposedFaces_;
+};
+
+} // end sierra namespace
+} // end nalu namespace
+
+#endif
@@ -76,6 +76,13 @@ public:
   void storeOwnersForShared();
   void finalizeLinearSystem();
 
+  /** Precompute, for every locally owned element that contributed to the
+   *  element graph, the offset of each node-pair coupling within its matrix
+   *  row so that element assembly avoids sorting and row searches.
+   */
+  void build_element_scatter_maps();
+  void set_use_element_scatter_maps(bool flag) { useElementScatterMaps_ = flag; }
+
   sierra::nalu::CoeffApplier* get_coeff_applier();
 
   // Matrix Assembly
@@ -106,6 +113,15 @@ public:
     const unsigned beginPos,
     const unsigned endPos);
 
+  //! Dirichlet rows for field components [beginPos, endPos) at dofs component + [beginPos, endPos)
+  void apply_dirichlet_bcs(
+    stk::mesh::FieldBase * solutionField,
+    stk::mesh::FieldBase * bcValuesField,
+    const stk::mesh::PartVector & parts,
+    const unsigned beginPos,
+    const unsigned endPos,
+    const unsigned component);
+
   /** Reset LHS and RHS for the given set of nodes to 0
    *
    *  @param nodeList A list of STK node entities whose rows are zeroed out
@@ -127,6 +143,15 @@ public:
     const double diag_value = 0.0,
     const double rhs_residual = 0.0);
 
+  //! Sum numDof dofs per entity into dofs component + [0, numDof) of the node rows
+  void sum_into_host(
+    const std::vector<stk::mesh::Entity> & entities,
+    std::vector<int> &scratchIds,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const unsigned numDof,
+    const unsigned component);
+
   // Solve
   int solve(stk::mesh::FieldBase * linearSolutionField);
   void loadComplete();
@@ -165,6 +190,9 @@ public:
   LinSys::LocalMatrix getOwnedLocalMatrix() { return ownedLocalMatrix_; }
   LinSys::LocalMatrix getSharedNotOwnedLocalMatrix() { return sharedNotOwnedLocalMatrix_; }
   LinSys::LocalOrdinal getMaxOwnedRowId() { return maxOwnedRowId_; }
+
+  LinSys::EntityToLIDView getElemScatterStart() { return elemScatterStart_; }
+  LinSys::EntityToLIDView getElemScatterOffsets() { return elemScatterOffsets_; }
   
   class TpetraLinSysCoeffApplier : public CoeffApplier
   {
@@ -176,14 +204,20 @@ public:
                              LinSys::LocalVector sharedNotOwnedLclRhs,
                              LinSys::EntityToLIDView entityLIDs,
                              LinSys::EntityToLIDView entityColLIDs,
-                             int maxOwnedRowId, int maxSharedNotOwnedRowId, unsigned numDof)
+                             int maxOwnedRowId, int maxSharedNotOwnedRowId, unsigned numDof,
+                             LinSys::EntityToLIDView elemScatterStart = LinSys::EntityToLIDView(),
+                             LinSys::EntityToLIDView elemScatterOffsets = LinSys::EntityToLIDView(),
+                             unsigned component = 0)
     : ownedLocalMatrix_(ownedLclMatrix),
       sharedNotOwnedLocalMatrix_(sharedNotOwnedLclMatrix),
       ownedLocalRhs_(ownedLclRhs),
       sharedNotOwnedLocalRhs_(sharedNotOwnedLclRhs),
       entityToLID_(entityLIDs),
       entityToColLID_(entityColLIDs),
+      elemScatterStart_(elemScatterStart),
+      elemScatterOffsets_(elemScatterOffsets),
       maxOwnedRowId_(maxOwnedRowId), maxSharedNotOwnedRowId_(maxSharedNotOwnedRowId), numDof_(numDof),
+      component_(component),
       devicePointer_(nullptr)
     {}
 
@@ -207,6 +241,16 @@ public:
                             const SharedMemView<const double**,DeviceShmem> & lhs,
                             const char * trace_tag);
 
+    KOKKOS_FUNCTION
+    virtual void sum_into_entity(stk::mesh::Entity entity,
+                                 unsigned numEntities,
+                                 const stk::mesh::NgpMesh::ConnectedNodes& entities,
+                                 const SharedMemView<int*,DeviceShmem> & localIds,
+                                 const SharedMemView<int*,DeviceShmem> & sortPermutation,
+                                 const SharedMemView<const double*,DeviceShmem> & rhs,
+                                 const SharedMemView<const double**,DeviceShmem> & lhs,
+                                 const char * trace_tag);
+
     void free_device_pointer();
 
     sierra::nalu::CoeffApplier* device_pointer();
@@ -216,8 +260,12 @@ public:
     LinSys::LocalVector ownedLocalRhs_, sharedNotOwnedLocalRhs_;
     LinSys::EntityToLIDView entityToLID_;
     LinSys::EntityToLIDView entityToColLID_;
+    LinSys::EntityToLIDView elemScatterStart_;
+    LinSys::EntityToLIDView elemScatterOffsets_;
     int maxOwnedRowId_, maxSharedNotOwnedRowId_;
+    // dofs assembled per node, starting at dof component_ of each node row
     unsigned numDof_;
+    unsigned component_;
     TpetraLinSysCoeffApplier* devicePointer_;
   };
 
@@ -278,6 +326,8 @@ public:
   Teuchos::RCP<LinSys::Graph>  sharedNotOwnedGraph_;
 
   Teuchos::RCP<LinSys::Matrix> ownedMatrix_;
+  //! Product of the matrix and the solution for the initial guess projection
+  Teuchos::RCP<LinSys::MultiVector> projectionWork_;
   Teuchos::RCP<LinSys::MultiVector> ownedRhs_;
   LinSys::LocalMatrix ownedLocalMatrix_;
   LinSys::LocalMatrix sharedNotOwnedLocalMatrix_;
@@ -297,7 +347,116 @@ public:
   LocalOrdinal maxOwnedRowId_; // = num_owned_nodes * numDof_
   LocalOrdinal maxSharedNotOwnedRowId_; // = (num_owned_nodes + num_sharedNotOwned_nodes) * numDof_
 
+  // element scatter maps: for an element with local offset e and n nodes,
+  // elemScatterOffsets_(elemScatterStart_(e) + i*n + j) is the position of
+  // node j's column block within node i's matrix row (-1 if absent)
+  bool useElementScatterMaps_{false};
+  stk::mesh::PartVector elemScatterParts_;
+  LinSys::EntityToLIDView elemScatterStart_;
+  LinSys::EntityToLIDView elemScatterOffsets_;
+
   std::vector<int> sortPermutation_;
+
+  // TpetraComponentLinearSystem views assembling into this system; the graph
+  // is finalized once all of them are done building it
+  unsigned numComponentViews_{0};
+  unsigned numFinalizedViews_{0};
+};
+
+/** A single dof of a TpetraLinearSystem with several dofs per node
+ *
+ *  Lets a scalar equation system assemble into the rows and columns of dof
+ *  `component` of a coupled block system that it shares with other equation
+ *  systems, e.g. k and omega of SST. The graph of the block is the union of
+ *  the graphs built through its views and is finalized once the last view is
+ *  finalized. Zeroing, load completion and the solve belong to the owner of
+ *  the block system; update_from_block() then picks up the solver statistics
+ *  and the nonlinear residual of this dof.
+ */
+class TpetraComponentLinearSystem : public LinearSystem
+{
+public:
+  TpetraComponentLinearSystem(
+    Realm &realm,
+    EquationSystem *eqSys,
+    LinearSolver * linearSolver,
+    TpetraLinearSystem& block,
+    const unsigned component);
+  ~TpetraComponentLinearSystem() = default;
+
+  void buildNodeGraph(const stk::mesh::PartVector & parts) { block_.buildNodeGraph(parts); }
+  void buildFaceToNodeGraph(const stk::mesh::PartVector & parts) { block_.buildFaceToNodeGraph(parts); }
+  void buildEdgeToNodeGraph(const stk::mesh::PartVector & parts) { block_.buildEdgeToNodeGraph(parts); }
+  void buildElemToNodeGraph(const stk::mesh::PartVector & parts) { block_.buildElemToNodeGraph(parts); }
+  void buildReducedElemToNodeGraph(const stk::mesh::PartVector & parts) { block_.buildReducedElemToNodeGraph(parts); }
+  void buildFaceElemToNodeGraph(const stk::mesh::PartVector & parts) { block_.buildFaceElemToNodeGraph(parts); }
+  void buildNonConformalNodeGraph(const stk::mesh::PartVector & parts) { block_.buildNonConformalNodeGraph(parts); }
+  void buildOversetNodeGraph(const stk::mesh::PartVector & parts) { block_.buildOversetNodeGraph(parts); }
+  void buildDirichletNodeGraph(const stk::mesh::PartVector & parts) { block_.buildDirichletNodeGraph(parts); }
+  void buildDirichletNodeGraph(const std::vector<stk::mesh::Entity>& nodes) { block_.buildDirichletNodeGraph(nodes); }
+  void buildDirichletNodeGraph(const stk::mesh::NgpMesh::ConnectedNodes nodes) { block_.buildDirichletNodeGraph(nodes); }
+  void finalizeLinearSystem();
+
+  sierra::nalu::CoeffApplier* get_coeff_applier();
+
+  void zeroSystem();
+
+  void sumInto(
+    unsigned numEntities,
+    const stk::mesh::NgpMesh::ConnectedNodes& entities,
+    const SharedMemView<const double*,DeviceShmem> & rhs,
+    const SharedMemView<const double**,DeviceShmem> & lhs,
+    const SharedMemView<int*,DeviceShmem> & localIds,
+    const SharedMemView<int*,DeviceShmem> & sortPermutation,
+    const char * trace_tag);
+
+  void sumInto(
+    const std::vector<stk::mesh::Entity> & entities,
+    std::vector<int> &scratchIds,
+    std::vector<double> &scratchVals,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0
+    );
+
+  void applyDirichletBCs(
+    stk::mesh::FieldBase * solutionField,
+    stk::mesh::FieldBase * bcValuesField,
+    const stk::mesh::PartVector & parts,
+    const unsigned beginPos,
+    const unsigned endPos);
+
+  void resetRows(
+    const std::vector<stk::mesh::Entity>& nodeList,
+    const unsigned beginPos,
+    const unsigned endPos,
+    const double diag_value = 0.0,
+    const double rhs_residual = 0.0);
+
+  void resetRows(
+    unsigned numNodes,
+    const stk::mesh::Entity* nodeList,
+    const unsigned beginPos,
+    const unsigned endPos,
+    const double diag_value = 0.0,
+    const double rhs_residual = 0.0);
+
+  int solve(stk::mesh::FieldBase * linearSolutionField);
+  void loadComplete();
+
+  void writeToFile(const char * filename, bool useOwned=true) { block_.writeToFile(filename, useOwned); }
+  void writeSolutionToFile(const char * filename, bool useOwned=true) { block_.writeSolutionToFile(filename, useOwned); }
+
+  //! Statistics of the last solve of the block system, residual of this dof
+  void update_from_block();
+
+protected:
+  void beginLinearSystemConstruction() {}
+  void checkError(const int /* err_code */, const char * /* msg */) {}
+
+private:
+  TpetraLinearSystem& block_;
+  const unsigned component_;
 };
 
 template<typename T1, typename T2>
@@ -14,7 +14,10 @@
 
 #include <NaluParsedTypes.h>
 #include <MovingAveragePostProcessor.h>
+#include <ElemDataRequestsGPU.h>
+#include <KokkosInterface.h>
 
+#include <map>
 #include <string>
 #include <vector>
 #include <utility>
@@ -105,10 +108,9 @@ public:
     const double& zeroCurrent,
     const double& dt);
 
-  // compute tke and stress for each type of operation
-  void compute_tke(
-    const bool isReynolds,
-    const std::string &averageBlockName,
+  // compute tke, vorticity, q-criterion and lambda-ci in a single pass
+  void compute_derived_quantities(
+    const AveragingInfo* avInfo,
     stk::mesh::Selector s_all_nodes);
 
   void compute_reynolds_stress(
@@ -153,18 +155,6 @@ public:
     const double &dt,
     stk::mesh::Selector s_all_nodes);
 
-  void compute_vorticity(
-    const std::string &averageBlockName,
-	stk::mesh::Selector s_all_nodes);
-
-  void compute_q_criterion(
-	const std::string &averageBlockName,
-	stk::mesh::Selector s_all_nodes);
-
-  void compute_lambda_ci(
-	const std::string &averageBlockName,
-	stk::mesh::Selector s_all_nodes);
-
   void compute_mean_resolved_ke(
 	const std::string &averageBlockName,
 	stk::mesh::Selector s_all_nodes);
@@ -182,6 +172,27 @@ public:
 
   // vector of averaging information
   std::vector<AveragingInfo *> averageInfoVec_;
+
+  // accumulate the averages every accumulationInterval_ steps
+  int accumulationInterval_{1};
+  int stepsSinceAccumulation_{0};
+  double timeSinceAccumulation_{0.0};
+
+private:
+  using FieldPair = Kokkos::pair<FieldInfoNGP, FieldInfoNGP>;
+  using FieldPairView = Kokkos::View<FieldPair*, Kokkos::LayoutRight, MemSpace>;
+
+  // device table of the Reynolds, Favre and resolved (primitive, average) pairs
+  struct FieldPairTable {
+    FieldPairView pairs;
+    FieldPairView::HostMirror hostPairs;
+    size_t syncCount{0};
+  };
+
+  // build the table on first use and after mesh modification only
+  FieldPairTable& field_pair_table(const AveragingInfo* avInfo);
+
+  std::map<const AveragingInfo*, FieldPairTable> fieldPairTables_;
 };
 
 } // namespace nalu
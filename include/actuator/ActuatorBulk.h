@@ -26,6 +26,18 @@ namespace nalu {
 
 struct ActuatorInfoNGP;
 
+/*! \brief Strategy used to assign turbines to MPI ranks
+ *
+ * RoundRobin reproduces the historical layout (turbine i on rank i modulo the
+ * number of ranks). SpreadNodes interleaves the shared-memory nodes so that
+ * consecutive turbines land on different nodes. LeastLoaded orders the ranks
+ * by their local fluid work so the turbine solves go to the lightest ranks.
+ */
+enum class ActuatorPlacement { RoundRobin, SpreadNodes, LeastLoaded };
+
+std::vector<int> compute_turbine_ranks(
+  int numTurbines, ActuatorPlacement placement, double localLoad = 0.0);
+
 /*! \brief Meta data for working with actuator fields
  * This is an example of meta data that will be used to construct an actuator
  * object and the resulting bulk data. This object lives on host but views can
@@ -48,6 +60,9 @@ struct ActuatorMeta
   stk::search::SearchMethod searchMethod_;
   ActScalarIntDv numPointsTurbine_;
   bool useFLLC_ = false;
+  bool useSearchCache_ = false;
+  double searchCacheSkin_ = 0.5;
+  ActuatorPlacement turbinePlacement_ = ActuatorPlacement::RoundRobin;
 };
 
 /*! \brief Where field data is stored and accessed for actuators
@@ -58,7 +73,7 @@ struct ActuatorMeta
  */
 struct ActuatorBulk
 {
-  ActuatorBulk(const ActuatorMeta& actMeta);
+  ActuatorBulk(const ActuatorMeta& actMeta, double localLoad = 0.0);
   virtual ~ActuatorBulk(){}
 
   void stk_search_act_pnts(
@@ -92,7 +107,12 @@ struct ActuatorBulk
   ActFixScalarBool pointIsLocal_;
   ActFixScalarInt localParallelRedundancy_;
   ActFixElemIds elemContainingPoint_;
+  ActuatorSearchCache searchCache_;
 
+  //! owning rank of every turbine and the turbines owned by this rank
+  std::vector<int> turbineRank_;
+  std::vector<int> localTurbineIds_;
+  //! first turbine owned by this rank, -1 if the rank owns none
   const int localTurbineId_;
 };
 
@@ -18,7 +18,8 @@ namespace nalu {
 struct ActuatorBulkDiskFAST : public ActuatorBulkFAST
 {
 public:
-  ActuatorBulkDiskFAST(ActuatorMetaFAST& actMeta, double naluTimeStep);
+  ActuatorBulkDiskFAST(
+    ActuatorMetaFAST& actMeta, double naluTimeStep, double localLoad = 0.0);
 
   ActFixArrayInt numSweptCount_;
   ActFixArrayInt numSweptOffset_;
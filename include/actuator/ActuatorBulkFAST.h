@@ -45,9 +45,14 @@ struct ActuatorMetaFAST : public ActuatorMeta
 
 struct ActuatorBulkFAST : public ActuatorBulk
 {
-  ActuatorBulkFAST(const ActuatorMetaFAST& actMeta, double naluTimeStep);
+  ActuatorBulkFAST(
+    const ActuatorMetaFAST& actMeta,
+    double naluTimeStep,
+    double localLoad = 0.0);
 
   Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace> local_range_policy();
+  Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>
+  local_range_policy(int turbId);
 
   void interpolate_velocities_to_fast();
   void step_fast();
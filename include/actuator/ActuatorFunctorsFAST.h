@@ -22,7 +22,7 @@ struct ActFastUpdatePoints
 {
   using execution_space = ActuatorFixedExecutionSpace;
 
-  ActFastUpdatePoints(ActuatorBulkFAST& actBulk);
+  ActFastUpdatePoints(ActuatorBulkFAST& actBulk, int turbId);
   void operator()(int index) const;
 
   ActDualViewHelper<ActuatorFixedMemSpace> helper_;
@@ -37,7 +37,11 @@ void RunActFastUpdatePoints(ActuatorBulkFAST& actBulk)
 {
   Kokkos::deep_copy(actBulk.pointCentroid_.view_host(),0.0);
   actBulk.pointCentroid_.modify_host();
-  Kokkos::parallel_for("ActFastUpdatePoints", actBulk.local_range_policy(), ActFastUpdatePoints(actBulk));
+  for (int turbId : actBulk.localTurbineIds_) {
+    Kokkos::parallel_for(
+      "ActFastUpdatePoints", actBulk.local_range_policy(turbId),
+      ActFastUpdatePoints(actBulk, turbId));
+  }
   actuator_utils::reduce_view_on_host(actBulk.pointCentroid_.view_host());
 }
 
@@ -45,7 +49,7 @@ struct ActFastAssignVel
 {
   using execution_space = ActuatorFixedExecutionSpace;
 
-  ActFastAssignVel(ActuatorBulkFAST& actBulk);
+  ActFastAssignVel(ActuatorBulkFAST& actBulk, int turbId);
   void operator()(int index) const;
 
   ActDualViewHelper<ActuatorFixedMemSpace> helper_;
@@ -55,11 +59,21 @@ struct ActFastAssignVel
   fast::OpenFAST& fast_;
 };
 
+inline
+void RunActFastAssignVel(ActuatorBulkFAST& actBulk)
+{
+  for (int turbId : actBulk.localTurbineIds_) {
+    Kokkos::parallel_for(
+      "ActFastAssignVel", actBulk.local_range_policy(turbId),
+      ActFastAssignVel(actBulk, turbId));
+  }
+}
+
 struct ActFastComputeForce
 {
   using execution_space = ActuatorFixedExecutionSpace;
 
-  ActFastComputeForce(ActuatorBulkFAST& actBulk);
+  ActFastComputeForce(ActuatorBulkFAST& actBulk, int turbId);
   void operator()(int index) const;
 
   ActDualViewHelper<ActuatorFixedMemSpace> helper_;
@@ -74,7 +88,11 @@ void RunActFastComputeForce(ActuatorBulkFAST& actBulk)
 {
   Kokkos::deep_copy(actBulk.actuatorForce_.view_host(),0.0);
   actBulk.actuatorForce_.modify_host();
-  Kokkos::parallel_for("ActFastComputeForce", actBulk.local_range_policy(), ActFastComputeForce(actBulk));
+  for (int turbId : actBulk.localTurbineIds_) {
+    Kokkos::parallel_for(
+      "ActFastComputeForce", actBulk.local_range_policy(turbId),
+      ActFastComputeForce(actBulk, turbId));
+  }
   actuator_utils::reduce_view_on_host(actBulk.actuatorForce_.view_host());
 }
 
@@ -93,7 +111,7 @@ struct ActFastStashOrientationVectors
 {
   using execution_space = ActuatorFixedExecutionSpace;
 
-  ActFastStashOrientationVectors(ActuatorBulkFAST& actBulk);
+  ActFastStashOrientationVectors(ActuatorBulkFAST& actBulk, int turbId);
 
   void operator()(int index) const;
 
@@ -109,7 +127,11 @@ void RunActFastStashOrientVecs(ActuatorBulkFAST& actBulk)
 {
   Kokkos::deep_copy(actBulk.orientationTensor_.view_host(),0.0);
   actBulk.orientationTensor_.modify_host();
-  Kokkos::parallel_for("ActFastStashOrientations", actBulk.local_range_policy(), ActFastStashOrientationVectors(actBulk));
+  for (int turbId : actBulk.localTurbineIds_) {
+    Kokkos::parallel_for(
+      "ActFastStashOrientations", actBulk.local_range_policy(turbId),
+      ActFastStashOrientationVectors(actBulk, turbId));
+  }
   actuator_utils::reduce_view_on_host(actBulk.orientationTensor_.view_host());
 }
 
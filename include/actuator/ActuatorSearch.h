@@ -16,6 +16,7 @@
 #include <stk_search/BoundingBox.hpp>
 #include <stk_search/IdentProc.hpp>
 #include <stk_search/SearchMethod.hpp>
+#include <vector>
 
 // common type defs
 using theKey = stk::search::IdentProc<uint64_t, int>;
@@ -55,6 +56,55 @@ void ExecuteFineSearch(
   ActFixScalarBool isLocalPoint,
   ActFixScalarInt localParallelRedundancy);
 
+/*! \brief Persistent search structures for actuator points
+ *
+ * The element boxes are built once per mesh state and every point keeps the
+ * list of candidate elements found with a sphere that is inflated by a skin
+ * factor. As long as a point's current search sphere stays inside the inflated
+ * sphere from its last search the candidate list is still complete, so only
+ * the points that moved farther than the skin are searched again. The element
+ * boxes are rebuilt whenever the bulk data has been modified (e.g. after a
+ * rebalance) or when the cache is explicitly reset.
+ */
+struct ActuatorSearchCache
+{
+  ActuatorSearchCache(double skinFactor = 0.5);
+
+  void reset();
+  bool is_current(const stk::mesh::BulkData& stkBulk, int numPoints) const;
+  void build(
+    stk::mesh::BulkData& stkBulk,
+    const std::vector<std::string>& partNameList,
+    int numPoints);
+
+  double skinFactor_;
+  bool isBuilt_{false};
+  size_t syncCount_{0};
+  //! element boxes, ident ids are indices into elemIds_
+  VecBoundElemBox elemBoxes_;
+  std::vector<uint64_t> elemIds_;
+  //! per point candidate element box indices from the inflated search
+  std::vector<std::vector<std::size_t>> candidates_;
+  //! sphere center/radius used for the last search of each point
+  std::vector<Point> searchCenter_;
+  std::vector<double> searchRadius_;
+  //! number of points that required a new coarse search on the last call
+  int numPointsSearched_{0};
+};
+
+void ExecuteCachedSearch(
+  stk::mesh::BulkData& stkBulk,
+  ActuatorSearchCache& cache,
+  ActFixVectorDbl points,
+  ActFixScalarDbl searchRadius,
+  stk::search::SearchMethod searchMethod,
+  ActScalarU64Dv& coarsePointIds,
+  ActScalarU64Dv& coarseElemIds,
+  ActFixElemIds matchElemIds,
+  ActFixVectorDbl localCoords,
+  ActFixScalarBool isLocalPoint,
+  ActFixScalarInt localParallelRedundancy);
+
 } // namespace nalu
 } // namespace sierra
 
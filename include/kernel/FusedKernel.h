@@ -0,0 +1,167 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef FUSEDKERNEL_H
+#define FUSEDKERNEL_H
+
+#include "kernel/Kernel.h"
+
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Compile-time list of kernels executed in order
+ *
+ *  The kernels are stored by value and called through qualified names, so the
+ *  calls are resolved at compile time instead of through the vtable.
+ */
+template<typename... Kernels>
+class KernelList
+{
+public:
+  KOKKOS_DEFAULTED_FUNCTION KernelList() = default;
+
+  void setup(const TimeIntegrator&) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  void execute(
+    SharedMemView<DoubleType**, DeviceShmem>&,
+    SharedMemView<DoubleType*, DeviceShmem>&,
+    ScratchViews<DoubleType, DeviceTeamHandleType, DeviceShmem>&)
+  {}
+};
+
+template<typename First, typename... Rest>
+class KernelList<First, Rest...>
+{
+public:
+  KernelList(const First& first, const Rest&... rest)
+    : kernel_(first), rest_(rest...)
+  {}
+
+  KOKKOS_DEFAULTED_FUNCTION KernelList() = default;
+
+  void setup(const TimeIntegrator& timeIntegrator)
+  {
+    kernel_.setup(timeIntegrator);
+    rest_.setup(timeIntegrator);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  void execute(
+    SharedMemView<DoubleType**, DeviceShmem>& lhs,
+    SharedMemView<DoubleType*, DeviceShmem>& rhs,
+    ScratchViews<DoubleType, DeviceTeamHandleType, DeviceShmem>& scratchViews)
+  {
+    kernel_.First::execute(lhs, rhs, scratchViews);
+    rest_.execute(lhs, rhs, scratchViews);
+  }
+
+private:
+  First kernel_;
+  KernelList<Rest...> rest_;
+};
+
+/** Kernel that executes a fixed stack of kernels with a single virtual call
+ *
+ *  Built by fuse_kernels from kernels that were already constructed
+ *  individually; the kernels are copied, so fusion has to happen before the
+ *  kernels are copied to the device.
+ */
+template<typename... Kernels>
+class FusedKernel : public NGPKernel<FusedKernel<Kernels...>>
+{
+public:
+  FusedKernel(const Kernels&... kernels)
+    : kernels_(kernels...)
+  {}
+
+  KOKKOS_DEFAULTED_FUNCTION FusedKernel() = default;
+
+  virtual ~FusedKernel() = default;
+
+  virtual void setup(const TimeIntegrator& timeIntegrator)
+  {
+    kernels_.setup(timeIntegrator);
+  }
+
+  using Kernel::execute;
+
+  KOKKOS_FUNCTION
+  virtual void execute(
+    SharedMemView<DoubleType**, DeviceShmem>& lhs,
+    SharedMemView<DoubleType*, DeviceShmem>& rhs,
+    ScratchViews<DoubleType, DeviceTeamHandleType, DeviceShmem>& scratchViews)
+  {
+    kernels_.execute(lhs, rhs, scratchViews);
+  }
+
+private:
+  KernelList<Kernels...> kernels_;
+};
+
+namespace impl {
+
+template<typename... Kernels>
+bool kernels_match(const std::vector<Kernel*>& kernels, size_t first)
+{
+  // braced initializers are evaluated in order
+  const bool matches[] = {(typeid(*kernels[first++]) == typeid(Kernels))...};
+  for (const bool match : matches)
+    if (!match) return false;
+  return true;
+}
+
+template<typename... Kernels, size_t... Is>
+Kernel* make_fused_kernel(
+  const std::vector<Kernel*>& kernels, const size_t first, std::index_sequence<Is...>)
+{
+  return new FusedKernel<Kernels...>(*static_cast<Kernels*>(kernels[first + Is])...);
+}
+
+} // namespace impl
+
+/** Replace the kernels `Kernels...` by a single FusedKernel
+ *
+ *  The kernels are only fused if they appear consecutively and in the given
+ *  order, so that the contributions are summed exactly as before; otherwise
+ *  the vector is left unchanged and the kernels run through the virtual
+ *  interface.
+ *
+ *  @return true if the kernels were fused
+ */
+template<typename... Kernels>
+bool fuse_kernels(std::vector<Kernel*>& kernels)
+{
+  constexpr size_t numFused = sizeof...(Kernels);
+  static_assert(numFused > 1, "fuse_kernels needs at least two kernels");
+
+  for (size_t first = 0; first + numFused <= kernels.size(); ++first) {
+    if (!impl::kernels_match<Kernels...>(kernels, first)) continue;
+
+    Kernel* fused = impl::make_fused_kernel<Kernels...>(
+      kernels, first, std::index_sequence_for<Kernels...>{});
+    for (size_t i = first; i < first + numFused; ++i)
+      delete kernels[i];
+
+    kernels[first] = fused;
+    kernels.erase(kernels.begin() + first + 1, kernels.begin() + first + numFused);
+    return true;
+  }
+  return false;
+}
+
+}  // nalu
+}  // sierra
+
+#endif /* FUSEDKERNEL_H */
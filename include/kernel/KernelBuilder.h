@@ -11,6 +11,7 @@
 #define KernelBuilder_h
 
 #include <kernel/Kernel.h>
+#include <kernel/FusedKernel.h>
 #include <AssembleElemSolverAlgorithm.h>
 #include <AssembleFaceElemSolverAlgorithm.h>
 #include <EquationSystem.h>
@@ -104,6 +105,31 @@ namespace nalu{
      }
    }
 
+  template <template <typename> class... T>
+  bool fuse_topo_kernels(stk::topology topo, std::vector<Kernel*>& kernels)
+  {
+    switch(topo.value()) {
+      case stk::topology::HEX_8:
+        return fuse_kernels<T<AlgTraitsHex8>...>(kernels);
+      case stk::topology::HEX_27:
+        return fuse_kernels<T<AlgTraitsHex27>...>(kernels);
+      case stk::topology::TET_4:
+        return fuse_kernels<T<AlgTraitsTet4>...>(kernels);
+      case stk::topology::PYRAMID_5:
+        return fuse_kernels<T<AlgTraitsPyr5>...>(kernels);
+      case stk::topology::WEDGE_6:
+        return fuse_kernels<T<AlgTraitsWed6>...>(kernels);
+      case stk::topology::QUAD_4_2D:
+        return fuse_kernels<T<AlgTraitsQuad4_2D>...>(kernels);
+      case stk::topology::QUAD_9_2D:
+        return fuse_kernels<T<AlgTraitsQuad9_2D>...>(kernels);
+      case stk::topology::TRI_3_2D:
+        return fuse_kernels<T<AlgTraitsTri3_2D>...>(kernels);
+      default:
+        return false;
+    }
+  }
+
   class KernelBuilder
   {
   public:
@@ -159,6 +185,21 @@ namespace nalu{
       return false;
     }
 
+    /** Execute the kernels T, if they were built consecutively and in this
+     *  order, as one FusedKernel without per-kernel virtual dispatch
+     */
+    template <template <typename> class... T>
+    bool fuse_topo_kernels_if_built()
+    {
+      if (!solverAlgWasBuilt_) return false;
+
+      const bool isFused = fuse_topo_kernels<T...>(part_.topology(), solverAlg_->activeKernels_);
+      if (isFused)
+        NaluEnv::self().naluOutputP0() << "Fused " << sizeof...(T)
+          << " element kernels of " << eqSys_.name_ << " on " << part_.topology().name() << std::endl;
+      return isFused;
+    }
+
   private:
     EquationSystem& eqSys_;
     stk::mesh::Part& part_;
@@ -0,0 +1,92 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef CHEBYSHEV_PRECONDITIONER_H
+#define CHEBYSHEV_PRECONDITIONER_H
+
+#include "Teuchos_RCP.hpp"
+#include "Tpetra_Map_decl.hpp"
+#include "Tpetra_MultiVector_decl.hpp"
+#include "Tpetra_Operator.hpp"
+
+namespace Teuchos {
+class ParameterList;
+}
+
+namespace sierra {
+namespace nalu {
+namespace matrix_free {
+
+struct ChebyshevParameters
+{
+  int degree{2};
+  double eigenvalue_ratio{20};
+  int power_iterations{10};
+};
+
+// Chebyshev polynomial in the Jacobi-scaled operator D^{-1} A.  The inverse
+// diagonal is provided by one of the Jacobi operators and the largest
+// eigenvalue of D^{-1} A is estimated with a few power iterations.
+// A degree of one reduces to a damped Jacobi sweep.
+//
+// This is a smoother only: there is no restriction to a coarser order and
+// no coarse solve, so it damps the upper part of the spectrum
+// [lambda_max / eigenvalue_ratio, lambda_max] and leaves the smooth error to
+// the Krylov solver.  The iteration count still grows with mesh refinement
+// for diffusion-dominated operators; it suits mass-dominated systems such
+// as momentum with small time steps.  Elliptic solves, e.g. the pressure
+// Poisson system, go through MueLu on the sparsified p = 1 Laplacian.
+class ChebyshevOperator final : public Tpetra::Operator<>
+{
+public:
+  using mv_type = Tpetra::MultiVector<>;
+  using map_type = Tpetra::Map<>;
+  using base_operator_type = Tpetra::Operator<>;
+
+  ChebyshevOperator(
+    Teuchos::RCP<const map_type> owned_map,
+    int num_vectors,
+    ChebyshevParameters params = {});
+
+  void apply(
+    const mv_type& ownedSolution,
+    mv_type& ownedRHS,
+    Teuchos::ETransp trans = Teuchos::NO_TRANS,
+    double alpha = 1.0,
+    double beta = 0.0) const final;
+
+  void set_linear_operator(Teuchos::RCP<const base_operator_type>);
+  void set_inverse_diagonal(const mv_type& inv_diag);
+  void compute_eigenvalue_estimate();
+  double max_eigenvalue() const { return lambda_max_; }
+
+  Teuchos::RCP<const map_type> getDomainMap() const final { return map_; }
+  Teuchos::RCP<const map_type> getRangeMap() const final { return map_; }
+
+private:
+  const Teuchos::RCP<const map_type> map_;
+  const ChebyshevParameters params_;
+  Teuchos::RCP<const base_operator_type> op_;
+  const mv_type* inv_diag_{nullptr};
+
+  double lambda_max_{1};
+  mutable mv_type residual_;
+  mutable mv_type direction_;
+};
+
+// Ifpack2 preconditioner parameter list entries selecting a Chebyshev
+// preconditioner
+bool chebyshev_requested(const Teuchos::ParameterList& params);
+ChebyshevParameters chebyshev_parameters(const Teuchos::ParameterList& params);
+
+} // namespace matrix_free
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -10,6 +10,7 @@
 #ifndef CONDUCTION_SOLUTION_UPDATE_H
 #define CONDUCTION_SOLUTION_UPDATE_H
 
+#include "matrix_free/ChebyshevPreconditioner.h"
 #include "matrix_free/ConductionJacobiPreconditioner.h"
 #include "matrix_free/ConductionOperator.h"
 #include "matrix_free/KokkosViewTypes.h"
@@ -63,6 +64,7 @@ public:
   static constexpr int num_vectors = 1;
   ConductionSolutionUpdate(
     Teuchos::ParameterList params,
+    const Teuchos::ParameterList& precond_params,
     const StkToTpetraMaps& linsys,
     const Tpetra::Export<>& exporter,
     const ConductionOffsetViews<p>& offset_views);
@@ -91,6 +93,8 @@ private:
   ConductionResidualOperator<p> resid_op_;
   ConductionLinearizedResidualOperator<p> lin_op_;
   JacobiOperator<p> prec_op_;
+  const bool use_chebyshev_;
+  ChebyshevOperator cheby_op_;
   MatrixFreeSolver linear_solver_;
   mutable Tpetra::MultiVector<> owned_and_shared_mv_;
 };
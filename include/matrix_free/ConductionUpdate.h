@@ -48,6 +48,7 @@ public:
   ConductionUpdate(
     stk::mesh::BulkData&,
     Teuchos::ParameterList,
+    Teuchos::ParameterList,
     stk::mesh::Selector active,
     stk::mesh::Selector dirichlet,
     stk::mesh::Selector flux,
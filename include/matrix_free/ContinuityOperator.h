@@ -43,10 +43,19 @@ public:
     mdot_ = mdot;
   }
 
+  void set_constraint_nodes(const_node_offset_view constraint_offsets_in)
+  {
+    constraints_active_ = constraint_offsets_in.extent_int(0) > 0;
+    constraint_offsets_ = constraint_offsets_in;
+  }
+
 private:
   const const_elem_offset_view<p> elem_offsets_;
   const export_type& exporter_;
 
+  bool constraints_active_{false};
+  const_node_offset_view constraint_offsets_;
+
   mutable mv_type cached_rhs_;
 
   double time_scale_;
@@ -86,9 +95,19 @@ public:
 
   void set_metric(const_scs_vector_view<p> metric) { metric_ = metric; }
 
+  void set_constraint_nodes(const_node_offset_view constraint_offsets_in)
+  {
+    constraints_active_ = constraint_offsets_in.extent_int(0) > 0;
+    constraint_offsets_ = constraint_offsets_in;
+  }
+
 private:
   const const_elem_offset_view<p> elem_offsets_;
   const export_type& exporter_;
+  const int max_owned_row_id_{0};
+
+  bool constraints_active_{false};
+  const_node_offset_view constraint_offsets_;
 
   const_scs_vector_view<p> metric_;
 
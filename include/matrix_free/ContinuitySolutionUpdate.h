@@ -51,6 +51,12 @@ public:
   void compute_preconditioner(
     Tpetra::CrsMatrix<>& mat, Teuchos::ParameterList& params);
 
+  void set_constraint_nodes(const_node_offset_view constraint_offsets)
+  {
+    resid_op_.set_constraint_nodes(constraint_offsets);
+    lin_op_.set_constraint_nodes(constraint_offsets);
+  }
+
   const MatrixFreeSolver& solver() const { return linear_solver_; }
   double residual_norm() const;
   double final_linear_norm() const;
@@ -14,10 +14,12 @@
 #include "matrix_free/LowMachInfo.h"
 
 #include "Kokkos_Array.hpp"
+#include "stk_mesh/base/Entity.hpp"
 #include "stk_mesh/base/NgpField.hpp"
 #include "stk_mesh/base/Part.hpp"
 
 #include <memory>
+#include <vector>
 
 #include "Tpetra_CrsMatrix_fwd.hpp"
 
@@ -104,6 +106,10 @@ public:
     std::string xmlname = "milestone.xml") = 0;
 
   virtual const LowMachPostProcess& post_processor() const = 0;
+
+  // rows that keep their values through the solves, e.g. overset fringes
+  virtual void
+  set_constraint_nodes(const std::vector<stk::mesh::Entity>& nodes) = 0;
 };
 
 template <template <int> class PhysicsUpdate, typename... Args>
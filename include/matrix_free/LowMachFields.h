@@ -63,6 +63,7 @@ struct LowMachBCFields
 {
   node_vector_view up1;
   node_vector_view ubc;
+  node_vector_view symm_up1;
   face_scalar_view<p> exposed_pressure;
   face_vector_view<p> exposed_areas;
 };
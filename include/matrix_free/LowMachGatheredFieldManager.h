@@ -28,7 +28,10 @@ class LowMachGatheredFieldManager
 public:
   using info = lowmach_info;
   LowMachGatheredFieldManager(
-    stk::mesh::BulkData&, stk::mesh::Selector, stk::mesh::Selector = {});
+    stk::mesh::BulkData&,
+    stk::mesh::Selector,
+    stk::mesh::Selector = {},
+    stk::mesh::Selector = {});
   void gather_all();
   void update_fields();
   void swap_states();
@@ -51,10 +54,12 @@ private:
   const stk::mesh::MetaData& meta;
   const stk::mesh::Selector active;
   const stk::mesh::Selector dirichlet;
+  const stk::mesh::Selector symmetry;
   const const_elem_mesh_index_view<p> conn;
   const const_face_mesh_index_view<p> exposed_faces;
   const const_node_mesh_index_view dirichlet_nodes;
-  
+  const const_node_mesh_index_view symmetry_nodes;
+
   LowMachResidualFields<p> fields;
   LowMachLinearizedResidualFields<p> coefficient_fields;
   LowMachBCFields<p> bc;
@@ -19,6 +19,7 @@
 #include "matrix_free/MomentumSolutionUpdate.h"
 #include "matrix_free/StkToTpetraMap.h"
 
+#include "stk_mesh/base/Entity.hpp"
 #include "stk_mesh/base/Selector.hpp"
 #include "stk_mesh/base/NgpField.hpp"
 
@@ -31,6 +32,7 @@
 #include "Tpetra_Export_fwd.hpp"
 
 #include <iosfwd>
+#include <vector>
 
 namespace stk {
 namespace mesh {
@@ -65,6 +67,7 @@ public:
     Teuchos::ParameterList,
     Teuchos::ParameterList,
     Teuchos::ParameterList,
+    Teuchos::ParameterList,
     stk::mesh::Selector,
     stk::mesh::Selector,
     Kokkos::View<gid_type*>);
@@ -72,10 +75,13 @@ public:
   LowMachUpdate(
     stk::mesh::BulkData& bulk_in,
     Teuchos::ParameterList params_mom,
+    Teuchos::ParameterList precond_params_mom,
     Teuchos::ParameterList params_cont,
     Teuchos::ParameterList params_grad,
     stk::mesh::Selector active,
     stk::mesh::Selector dirichlet_wall,
+    stk::mesh::Selector symmetry,
+    int symmetry_normal,
     const Tpetra::Map<>& owned,
     const Tpetra::Map<>& owned_and_shared,
     Kokkos::View<const lid_type*> elids);
@@ -123,15 +129,20 @@ public:
 
   const LowMachPostProcess& post_processor() const { return post_process_; }
 
+  void set_constraint_nodes(const std::vector<stk::mesh::Entity>& nodes);
+
 private:
   stk::mesh::BulkData& bulk_;
   const stk::mesh::Selector active_;
   const stk::mesh::Selector dirichlet_;
+  const stk::mesh::Selector symmetry_;
+  const int symmetry_normal_{2};
   const StkToTpetraMaps linsys_;
   const Tpetra::Export<> exporter_;
   const const_elem_offset_view<p> offsets_;
   const const_face_offset_view<p> exposed_face_offsets_;
   const const_node_offset_view dirichlet_offsets_;
+  const const_node_offset_view symmetry_offsets_;
 
   LowMachGatheredFieldManager<p> field_gather_;
   LowMachPostProcessP<p> post_process_;
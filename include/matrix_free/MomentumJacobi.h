@@ -51,6 +51,19 @@ public:
     dirichlet_bc_offsets_ = dirichlet;
   }
 
+  void set_symmetry_nodes(const_node_offset_view symmetry, int normal)
+  {
+    symmetry_bc_active_ = symmetry.extent(0) > 0;
+    symmetry_bc_offsets_ = symmetry;
+    symmetry_normal_ = normal;
+  }
+
+  void set_constraint_nodes(const_node_offset_view constraints)
+  {
+    constraints_active_ = constraints.extent(0) > 0;
+    constraint_offsets_ = constraints;
+  }
+
   Teuchos::RCP<const map_type> getDomainMap() const final
   {
     return exporter.getTargetMap();
@@ -71,6 +84,13 @@ private:
   bool dirichlet_bc_active_{false};
   const_node_offset_view dirichlet_bc_offsets_;
 
+  bool symmetry_bc_active_{false};
+  const_node_offset_view symmetry_bc_offsets_;
+  int symmetry_normal_{2};
+
+  bool constraints_active_{false};
+  const_node_offset_view constraint_offsets_;
+
   Teuchos::RCP<const base_operator_type> op;
 };
 
@@ -61,6 +61,20 @@ public:
     ThrowRequire(bc.ubc.extent_int(0) == bc.up1.extent_int(0));
   }
 
+  void
+  set_symmetry_nodes(const_node_offset_view symmetry_offsets_in, int normal)
+  {
+    symmetry_bc_active_ = symmetry_offsets_in.extent_int(0) > 0;
+    symmetry_bc_offsets_ = symmetry_offsets_in;
+    symmetry_normal_ = normal;
+  }
+
+  void set_constraint_nodes(const_node_offset_view constraint_offsets_in)
+  {
+    constraints_active_ = constraint_offsets_in.extent_int(0) > 0;
+    constraint_offsets_ = constraint_offsets_in;
+  }
+
 private:
   const const_elem_offset_view<p> elem_offsets_;
   const export_type& exporter_;
@@ -72,6 +86,13 @@ private:
   const_node_offset_view dirichlet_bc_offsets_;
   LowMachBCFields<p> bc_;
 
+  bool symmetry_bc_active_{false};
+  const_node_offset_view symmetry_bc_offsets_;
+  int symmetry_normal_{2};
+
+  bool constraints_active_{false};
+  const_node_offset_view constraint_offsets_;
+
   Kokkos::Array<double, 3> gammas_;
   LowMachResidualFields<p> fields_;
 };
@@ -120,6 +141,20 @@ public:
     dirichlet_bc_offsets_ = dirichlet_offsets_in;
   }
 
+  void
+  set_symmetry_nodes(const_node_offset_view symmetry_offsets_in, int normal)
+  {
+    symmetry_bc_active_ = symmetry_offsets_in.extent_int(0) > 0;
+    symmetry_bc_offsets_ = symmetry_offsets_in;
+    symmetry_normal_ = normal;
+  }
+
+  void set_constraint_nodes(const_node_offset_view constraint_offsets_in)
+  {
+    constraints_active_ = constraint_offsets_in.extent_int(0) > 0;
+    constraint_offsets_ = constraint_offsets_in;
+  }
+
 private:
   const const_elem_offset_view<p> elem_offsets_;
   const export_type& exporter_;
@@ -131,6 +166,13 @@ private:
   bool dirichlet_bc_active_{false};
   const_node_offset_view dirichlet_bc_offsets_;
 
+  bool symmetry_bc_active_{false};
+  const_node_offset_view symmetry_bc_offsets_;
+  int symmetry_normal_{2};
+
+  bool constraints_active_{false};
+  const_node_offset_view constraint_offsets_;
+
   mutable mv_type cached_sln_;
   mutable mv_type cached_rhs_;
 };
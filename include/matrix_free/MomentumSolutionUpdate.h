@@ -10,6 +10,7 @@
 #ifndef MOMENTUM_SOLUTION_UPDATE_H
 #define MOMENTUM_SOLUTION_UPDATE_H
 
+#include "matrix_free/ChebyshevPreconditioner.h"
 #include "matrix_free/KokkosViewTypes.h"
 #include "matrix_free/MatrixFreeSolver.h"
 #include "matrix_free/MomentumJacobi.h"
@@ -46,6 +47,7 @@ public:
   static constexpr int num_vectors = 3;
   MomentumSolutionUpdate(
     Teuchos::ParameterList,
+    const Teuchos::ParameterList&,
     const StkToTpetraMaps&,
     const Tpetra::Export<>&,
     const_elem_offset_view<p>,
@@ -59,6 +61,22 @@ public:
   const Tpetra::MultiVector<double>&
   compute_delta(double, LowMachLinearizedResidualFields<p>);
   void compute_preconditioner(double, LowMachLinearizedResidualFields<p>);
+
+  // zero normal velocity on an axis-aligned symmetry plane
+  void set_symmetry_nodes(const_node_offset_view symmetry_offsets, int normal)
+  {
+    resid_op_.set_symmetry_nodes(symmetry_offsets, normal);
+    lin_op_.set_symmetry_nodes(symmetry_offsets, normal);
+    prec_op_.set_symmetry_nodes(symmetry_offsets, normal);
+  }
+
+  void set_constraint_nodes(const_node_offset_view constraint_offsets)
+  {
+    resid_op_.set_constraint_nodes(constraint_offsets);
+    lin_op_.set_constraint_nodes(constraint_offsets);
+    prec_op_.set_constraint_nodes(constraint_offsets);
+  }
+
   const MatrixFreeSolver& solver() const { return linear_solver_; }
 
   double residual_norm() const;
@@ -74,6 +92,8 @@ private:
   MomentumResidualOperator<p> resid_op_;
   MomentumLinearizedResidualOperator<p> lin_op_;
   MomentumJacobiOperator<p> prec_op_;
+  const bool use_chebyshev_;
+  ChebyshevOperator cheby_op_;
 
   MatrixFreeSolver linear_solver_;
   mutable Tpetra::MultiVector<> owned_and_shared_mv_;
@@ -39,6 +39,17 @@ struct face_offsets_t
 };
 } // namespace impl
 P_INVOKEABLE(face_offsets)
+namespace impl {
+// nodes of the element behind each face, ordered so that element node
+// (0, j, i) is face node (j, i) and k points into the element
+template <int p>
+struct face_element_map_t
+{
+  static elem_mesh_index_view<p>
+  invoke(const stk::mesh::NgpMesh&, const stk::mesh::Selector&);
+};
+} // namespace impl
+P_INVOKEABLE(face_element_map)
 } // namespace matrix_free
 } // namespace nalu
 } // namespace sierra
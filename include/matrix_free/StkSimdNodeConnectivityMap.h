@@ -15,6 +15,8 @@
 
 #include "stk_mesh/base/Selector.hpp"
 
+#include <vector>
+
 namespace stk {
 namespace mesh {
 struct Entity;
@@ -33,6 +35,10 @@ node_offset_view simd_node_offsets(
   const stk::mesh::Selector&,
   ra_entity_row_view_type);
 
+// offsets of a node list that only the host knows, e.g. overset fringes
+node_offset_view simd_node_offsets(
+  const std::vector<stk::mesh::Entity>&, ra_entity_row_view_type);
+
 } // namespace matrix_free
 } // namespace nalu
 } // namespace sierra
@@ -46,6 +46,34 @@ void dirichlet_linearized(
 void dirichlet_diagonal(
   const_node_offset_view offsets, int max_owned_lid, tpetra_view_type yout);
 
+// zero value for a single component, e.g. the normal velocity on a symmetry
+// plane; the remaining components keep their rows
+void component_dirichlet_residual(
+  const_node_offset_view offsets,
+  const_node_vector_view qp1,
+  int component,
+  int max_owned_row_lid,
+  tpetra_view_type yout);
+
+void component_dirichlet_linearized(
+  const_node_offset_view offsets,
+  int component,
+  int max_owned_row_lid,
+  ra_tpetra_view_type xin,
+  tpetra_view_type yout);
+
+void component_dirichlet_diagonal(
+  const_node_offset_view offsets,
+  int component,
+  int max_owned_lid,
+  tpetra_view_type yout);
+
+// rows whose value is set outside the solve, e.g. overset fringe nodes:
+// zero residual here and dirichlet_linearized/dirichlet_diagonal for the
+// operator
+void constraint_residual(
+  const_node_offset_view offsets, tpetra_view_type yout);
+
 } // namespace matrix_free
 } // namespace nalu
 } // namespace sierra
@@ -0,0 +1,63 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef SURFACE_FORCE_H
+#define SURFACE_FORCE_H
+
+#include "matrix_free/PolynomialOrders.h"
+
+#include "Kokkos_Array.hpp"
+
+#include "stk_mesh/base/Ngp.hpp"
+#include "stk_mesh/base/NgpField.hpp"
+#include "stk_mesh/base/Selector.hpp"
+
+namespace sierra {
+namespace nalu {
+namespace matrix_free {
+
+namespace impl {
+// rank-local pressure force (0-2) and its moment about centroid (3-5)
+// integrated over the selected faces with the nodal face quadrature
+template <int p>
+struct pressure_force_and_moment_t
+{
+  static Kokkos::Array<double, 6> invoke(
+    const stk::mesh::NgpMesh& mesh,
+    const stk::mesh::Selector& faces,
+    const stk::mesh::NgpField<double>& coords,
+    const stk::mesh::NgpField<double>& pressure,
+    Kokkos::Array<double, 3> centroid);
+};
+} // namespace impl
+SWITCH_INVOKEABLE(pressure_force_and_moment)
+
+namespace impl {
+// rank-local viscous traction force (0-2) and its moment about centroid (3-5)
+// from the velocity gradient of the element behind each face; the dilatation
+// term is scaled by include_div_u as in the assembled algorithm
+template <int p>
+struct viscous_force_and_moment_t
+{
+  static Kokkos::Array<double, 6> invoke(
+    const stk::mesh::NgpMesh& mesh,
+    const stk::mesh::Selector& faces,
+    const stk::mesh::NgpField<double>& coords,
+    const stk::mesh::NgpField<double>& velocity,
+    const stk::mesh::NgpField<double>& viscosity,
+    double include_div_u,
+    Kokkos::Array<double, 3> centroid);
+};
+} // namespace impl
+SWITCH_INVOKEABLE(viscous_force_and_moment)
+
+} // namespace matrix_free
+} // namespace nalu
+} // namespace sierra
+#endif
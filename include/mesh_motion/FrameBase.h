@@ -37,6 +37,14 @@ public:
   {
   }
 
+  //! Whether any motion in this frame transforms nodes individually
+  bool is_deforming() const
+  {
+    for (const auto& mm: meshMotionVec_)
+      if (mm->is_deforming()) return true;
+    return false;
+  }
+
 protected:
   /** Compute transformation matrix
    *
@@ -25,12 +25,25 @@ public:
   {
   }
 
+  /** Update current coordinates, displacement and mesh velocity
+   *
+   *  Frames without deforming motions compute the composite transformation
+   *  once and update the fields on device; the others are updated per node
+   *  on host.
+   */
   void update_coordinates_velocity(const double time);
 
   void post_compute_geometry();
 
+  //! Per-node update on host; required for deforming motions
+  void update_on_host(const double time);
+
+  //! Single affine update on device; valid only if the frame is not deforming
+  void update_on_device(const double time);
+
 private:
   FrameMoving() = delete;
+
   FrameMoving(const FrameMoving&) = delete;
 };
 
@@ -43,6 +43,17 @@ public:
 
   virtual void build_transformation(const double, const double* = nullptr) = 0;
 
+  /** Whether the transformation depends on the node position
+   *
+   *  Motions that are not deforming have the same transformation matrix for
+   *  every node and a velocity that is affine in the model and transformed
+   *  coordinates.
+   */
+  virtual bool is_deforming() const
+  {
+    return false;
+  }
+
   /** Function to compute motion-specific velocity
    *
    * @param[in] time           Current time
@@ -21,6 +21,11 @@ public:
 
   virtual void build_transformation(const double, const double*);
 
+  virtual bool is_deforming() const
+  {
+    return true;
+  }
+
   /** Function to compute motion-specific velocity
    *
    * @param[in] time           Current time
@@ -0,0 +1,151 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+
+#ifndef DevicePropertyEvaluators_h
+#define DevicePropertyEvaluators_h
+
+#include <KokkosInterface.h>
+
+#include <stk_math/StkMath.hpp>
+
+#include <memory>
+#include <string>
+
+namespace stk {
+namespace mesh {
+class FieldBase;
+class MetaData;
+class Selector;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class PropertyEvaluator;
+class Realm;
+
+/** Value-semantics, device-callable counterparts of the PropertyEvaluator
+ *  classes
+ *
+ *  The coefficients are extracted from the host evaluator once at setup so
+ *  that the property update is a single batched loop over the selected nodes
+ *  instead of one virtual call per node on the host.
+ */
+
+//! Largest species count supported by the device evaluators
+constexpr int maxDevicePropertySpecies = 16;
+
+//! Piecewise quartic in T; covers the water correlations and the NASA
+//! specific heat of a reference mixture (species sum folded into the coeffs)
+struct PolynomialTDeviceEvaluator
+{
+  Kokkos::Array<double, 5> low{{0, 0, 0, 0, 0}};
+  Kokkos::Array<double, 5> high{{0, 0, 0, 0, 0}};
+  double tSwitch{0.0};
+
+  KOKKOS_INLINE_FUNCTION
+  double operator()(const double T) const
+  {
+    const auto& c = (T < tSwitch) ? low : high;
+    return c[0] + T * (c[1] + T * (c[2] + T * (c[3] + T * c[4])));
+  }
+};
+
+//! Sutherland's law summed over the reference mass fractions
+struct SutherlandsTDeviceEvaluator
+{
+  Kokkos::Array<double, maxDevicePropertySpecies> yRef;
+  Kokkos::Array<double, maxDevicePropertySpecies> muRef;
+  Kokkos::Array<double, maxDevicePropertySpecies> tRef;
+  Kokkos::Array<double, maxDevicePropertySpecies> sRef;
+  int numSpecies{0};
+
+  KOKKOS_INLINE_FUNCTION
+  double operator()(const double T) const
+  {
+    double sum_mu = 0.0;
+    for (int k = 0; k < numSpecies; ++k) {
+      sum_mu += yRef[k] * muRef[k] * stk::math::pow(T / tRef[k], 1.5) *
+                (tRef[k] + sRef[k]) / (T + sRef[k]);
+    }
+    return sum_mu;
+  }
+};
+
+//! rho = pRef mw / (R T)
+struct IdealGasTDeviceEvaluator
+{
+  double pRefMwOverR{0.0};
+
+  KOKKOS_INLINE_FUNCTION
+  double operator()(const double T) const { return pRefMwOverR / T; }
+};
+
+//! rho = P mw / (R T)
+struct IdealGasTPDeviceEvaluator
+{
+  double mwOverR{0.0};
+
+  KOKKOS_INLINE_FUNCTION
+  double operator()(const double T, const double P) const
+  {
+    return P * mwOverR / T;
+  }
+};
+
+//! scale * sum_k(w_k Y_k), or its reciprocal; covers the fixed temperature
+//! evaluators that only depend on the transported mass fractions
+struct MassFractionDeviceEvaluator
+{
+  Kokkos::Array<double, maxDevicePropertySpecies> weights;
+  int numSpecies{0};
+  double scale{1.0};
+  bool reciprocal{false};
+
+  template <typename FieldType, typename MeshIndex>
+  KOKKOS_INLINE_FUNCTION
+  double operator()(const FieldType& yk, const MeshIndex& mi) const
+  {
+    double sum = 0.0;
+    for (int k = 0; k < numSpecies; ++k)
+      sum += weights[k] * yk.get(mi, k);
+    return reciprocal ? scale / sum : scale * sum;
+  }
+};
+
+/** Batched nodal property update on device
+ */
+class DevicePropertyKernel
+{
+public:
+  virtual ~DevicePropertyKernel() = default;
+
+  virtual void execute(
+    Realm& realm,
+    const stk::mesh::Selector& selector,
+    stk::mesh::FieldBase& prop) const = 0;
+};
+
+/** Create the device kernel matching a host property evaluator
+ *
+ *  @return nullptr when the evaluator has no device counterpart, in which
+ *  case the caller falls back to the per-node host evaluation
+ */
+std::unique_ptr<DevicePropertyKernel> make_device_property_kernel(
+  const PropertyEvaluator& propEvaluator,
+  const stk::mesh::MetaData& meta,
+  const std::string& tempName = "temperature");
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
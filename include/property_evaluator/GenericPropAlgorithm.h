@@ -13,6 +13,7 @@
 #define GenericPropAlgorithm_h
 
 #include <Algorithm.h>
+#include <property_evaluator/DevicePropertyEvaluators.h>
 
 namespace stk {
 namespace mesh {
@@ -43,7 +44,9 @@ public:
 
   stk::mesh::FieldBase *prop_;
   PropertyEvaluator *propEvaluator_;
-  
+
+  // batched device evaluation; null when only the host evaluator applies
+  std::unique_ptr<DevicePropertyKernel> deviceKernel_;
 };
 
 } // namespace nalu
@@ -13,6 +13,7 @@
 #define TemperaturePropAlgorithm_h
 
 #include <Algorithm.h>
+#include <property_evaluator/DevicePropertyEvaluators.h>
 
 // standard c++
 #include <string>
@@ -48,7 +49,9 @@ public:
   stk::mesh::FieldBase *prop_;
   PropertyEvaluator *propEvaluator_;
   stk::mesh::FieldBase *temperature_;
-  
+
+  // batched device evaluation; null when only the host evaluator applies
+  std::unique_ptr<DevicePropertyKernel> deviceKernel_;
 };
 
 } // namespace nalu
@@ -0,0 +1,239 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+
+#ifndef DeviceTable_h
+#define DeviceTable_h
+
+#include <KokkosInterface.h>
+
+#include <stk_util/util/ReportHandler.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+/**
+ *  @class  DeviceTable
+ *  @brief  Flat, device resident multilinear lookup table
+ *
+ *  The independent variable meshes and the tabulated values of an HDF5Table
+ *  property are copied once into flat Kokkos views; values are stored with
+ *  the last independent variable varying fastest. The interval of each input
+ *  is found in constant time on uniform meshes and by binary search
+ *  otherwise. Inputs are clipped to the table bounds, and the number of
+ *  clipped queries below and above the bounds of each independent variable
+ *  is accumulated in device counters instead of a host event log.
+ */
+class DeviceTable
+{
+public:
+  static constexpr int maxDimension = 8;
+
+  using InputView = Kokkos::View<const double**, Kokkos::LayoutRight, MemSpace>;
+  using ResultView = Kokkos::View<double*, MemSpace>;
+
+  DeviceTable(
+    const std::vector<std::vector<double>>& mesh,
+    const std::vector<double>& values)
+    : dimension_(mesh.size())
+  {
+    ThrowRequireMsg(dimension_ > 0 && dimension_ <= maxDimension,
+      "DeviceTable: unsupported number of independent variables");
+
+    size_t numMeshPoints = 0;
+    size_t numValues = 1;
+    for (const auto& m : mesh) {
+      ThrowRequireMsg(!m.empty(), "DeviceTable: empty independent variable mesh");
+      numMeshPoints += m.size();
+      numValues *= m.size();
+    }
+    ThrowRequireMsg(values.size() == numValues,
+      "DeviceTable: number of values does not match the independent variable meshes");
+
+    mesh_ = Kokkos::View<double*, MemSpace>("device_table_mesh", numMeshPoints);
+    values_ = Kokkos::View<double*, MemSpace>("device_table_values", numValues);
+    offset_ = Kokkos::View<int*, MemSpace>("device_table_offset", dimension_);
+    size_ = Kokkos::View<int*, MemSpace>("device_table_size", dimension_);
+    stride_ = Kokkos::View<int*, MemSpace>("device_table_stride", dimension_);
+    uniformSpacing_ = Kokkos::View<double*, MemSpace>("device_table_spacing", dimension_);
+    clipCounts_ = Kokkos::View<unsigned long long*, MemSpace>(
+      "device_table_clip_counts", 2 * dimension_ + 1);
+
+    auto hostMesh = Kokkos::create_mirror_view(mesh_);
+    auto hostValues = Kokkos::create_mirror_view(values_);
+    auto hostOffset = Kokkos::create_mirror_view(offset_);
+    auto hostSize = Kokkos::create_mirror_view(size_);
+    auto hostStride = Kokkos::create_mirror_view(stride_);
+    auto hostSpacing = Kokkos::create_mirror_view(uniformSpacing_);
+
+    int offset = 0;
+    int stride = 1;
+    for (int d = dimension_ - 1; d >= 0; --d) {
+      hostStride(d) = stride;
+      stride *= mesh[d].size();
+    }
+    for (int d = 0; d < dimension_; ++d) {
+      const auto& m = mesh[d];
+      const int n = m.size();
+      hostOffset(d) = offset;
+      hostSize(d) = n;
+      for (int i = 0; i < n; ++i)
+        hostMesh(offset + i) = m[i];
+      offset += n;
+
+      // zero spacing selects the binary search
+      hostSpacing(d) = 0.0;
+      if (n > 1) {
+        const double dx = (m[n - 1] - m[0]) / (n - 1);
+        bool uniform = dx > 0.0;
+        for (int i = 1; i < n && uniform; ++i)
+          uniform = std::abs(m[i] - m[0] - i * dx) <= 1.0e-10 * std::abs(m[n - 1] - m[0]);
+        if (uniform)
+          hostSpacing(d) = dx;
+      }
+    }
+    for (size_t i = 0; i < numValues; ++i)
+      hostValues(i) = values[i];
+
+    Kokkos::deep_copy(mesh_, hostMesh);
+    Kokkos::deep_copy(values_, hostValues);
+    Kokkos::deep_copy(offset_, hostOffset);
+    Kokkos::deep_copy(size_, hostSize);
+    Kokkos::deep_copy(stride_, hostStride);
+    Kokkos::deep_copy(uniformSpacing_, hostSpacing);
+    Kokkos::deep_copy(clipCounts_, 0);
+  }
+
+  int dimension() const { return dimension_; }
+
+  /** Evaluate the table for every row of inputs (numQueries x dimension) in
+   *  one kernel */
+  void query(const InputView& inputs, const ResultView& result) const
+  {
+    ThrowRequire(inputs.extent_int(1) == dimension_);
+    ThrowRequire(inputs.extent(0) == result.extent(0));
+
+    const DeviceTable table = *this;
+    Kokkos::parallel_for(
+      "DeviceTable::query",
+      Kokkos::RangePolicy<DeviceSpace, int>(0, result.extent_int(0)),
+      KOKKOS_LAMBDA(const int k) {
+        double x[maxDimension];
+        for (int d = 0; d < table.dimension_; ++d)
+          x[d] = inputs(k, d);
+        result(k) = table.value(x);
+      });
+  }
+
+  /** Clipped and interpolated value at one point; x is clipped in place */
+  KOKKOS_INLINE_FUNCTION
+  double value(double* x) const
+  {
+    int index[maxDimension];
+    double frac[maxDimension];
+
+    bool clipped = false;
+    for (int d = 0; d < dimension_; ++d) {
+      const int n = size_(d);
+      const double* m = &mesh_(offset_(d));
+
+      if (x[d] < m[0]) {
+        x[d] = m[0];
+        Kokkos::atomic_add(&clipCounts_(2 * d), 1ull);
+        clipped = true;
+      }
+      else if (x[d] > m[n - 1]) {
+        x[d] = m[n - 1];
+        Kokkos::atomic_add(&clipCounts_(2 * d + 1), 1ull);
+        clipped = true;
+      }
+
+      if (n < 2) {
+        index[d] = 0;
+        frac[d] = 0.0;
+        continue;
+      }
+
+      int lo = 0;
+      if (uniformSpacing_(d) > 0.0) {
+        lo = static_cast<int>((x[d] - m[0]) / uniformSpacing_(d));
+        lo = (lo < 0) ? 0 : ((lo > n - 2) ? n - 2 : lo);
+      }
+      else {
+        int hi = n - 1;
+        while (hi - lo > 1) {
+          const int mid = (lo + hi) / 2;
+          if (x[d] < m[mid])
+            hi = mid;
+          else
+            lo = mid;
+        }
+      }
+      index[d] = lo;
+      frac[d] = (x[d] - m[lo]) / (m[lo + 1] - m[lo]);
+    }
+    if (clipped)
+      Kokkos::atomic_add(&clipCounts_(2 * dimension_), 1ull);
+
+    // multilinear interpolation over the corners of the cell
+    double result = 0.0;
+    for (int corner = 0; corner < (1 << dimension_); ++corner) {
+      double w = 1.0;
+      int flat = 0;
+      for (int d = 0; d < dimension_; ++d) {
+        const int upper = (corner >> d) & 1;
+        w *= upper ? frac[d] : 1.0 - frac[d];
+        const int i = index[d] + upper;
+        flat += ((i < size_(d)) ? i : size_(d) - 1) * stride_(d);
+      }
+      if (w != 0.0)
+        result += w * values_(flat);
+    }
+    return result;
+  }
+
+  /** Number of queries that were clipped in any input */
+  size_t num_clipping_events() const
+  {
+    return clip_counts()[2 * dimension_];
+  }
+
+  /** Clipped queries below and above the bounds, per independent variable */
+  std::vector<size_t> clip_counts() const
+  {
+    auto hostCounts = Kokkos::create_mirror_view(clipCounts_);
+    Kokkos::deep_copy(hostCounts, clipCounts_);
+    return std::vector<size_t>(hostCounts.data(), hostCounts.data() + hostCounts.extent(0));
+  }
+
+  void clear_clipping_log() const { Kokkos::deep_copy(clipCounts_, 0); }
+
+private:
+  int dimension_;
+
+  // independent variable meshes, concatenated
+  Kokkos::View<double*, MemSpace> mesh_;
+  Kokkos::View<int*, MemSpace> offset_;
+  Kokkos::View<int*, MemSpace> size_;
+  Kokkos::View<double*, MemSpace> uniformSpacing_;
+
+  Kokkos::View<double*, MemSpace> values_;
+  Kokkos::View<int*, MemSpace> stride_;
+
+  Kokkos::View<unsigned long long*, MemSpace> clipCounts_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -27,6 +27,7 @@ class Realm;
 class TurbulenceAveragingPostProcessing;
 class AveragingInfo;
 class BdyHeightAlgorithm;
+class PlanarAveraging;
 
 /** Boundary layer statistics post-processing utility
  *
@@ -107,11 +108,8 @@ public:
   //!
   int abl_height_index(const double) const;
 
-  //! Process the velocity data and compute averages
-  void impl_compute_velocity_stats();
-
-  //! Process the temperature field and compute averages
-  void impl_compute_temperature_stats();
+  //! Accumulate the per-height sums of all statistics and post their reduction
+  void impl_compute_statistics();
 
 private:
   BdyLayerStatistics() = delete;
@@ -123,6 +121,15 @@ private:
   //! Initialize necessary parameters in sierra::nalu::TurbulenceAveragingPostProcessing
   void setup_turbulence_averaging(const double);
 
+  //! Complete the reduction and turn the sums into averages
+  void finish_statistics();
+
+  //! Compute velocity and stress averages from the reduced sums
+  void process_velocity_stats();
+
+  //! Compute temperature averages from the reduced sums
+  void process_temperature_stats();
+
   //! Output averaged velocity and stress profiles as a function of height
   void output_velocity_averages();
 
@@ -152,58 +159,35 @@ private:
   //! Reference to Realm object
   Realm& realm_;
 
-  //! Spatially averaged instantaneous velocity at desired heights [nHeights, nDim]
-  ArrayType d_velAvg_;
-
-  //! Spatially averaged instantaneous horizontal velocity magnitude at desired heights [nHeights]
-  ArrayType d_velMagAvg_;
-
-  //! Spatially and temporally averaged velocity at desired heights [nHeights, nDim]
-  ArrayType d_velBarAvg_;
-
-  //! Spatially averaged resolved stress [nHeights, nDim]
-  ArrayType d_uiujAvg_;
-
-  //! Spatially averaged sfs stress [nHeights, nDim]
-  ArrayType d_sfsAvg_;
-
-  //! Spatially and temporally averaged resolved stress field at desired heights [nHeights, nDim * 2]
-  ArrayType d_uiujBarAvg_;
-
-  //! Spatially and temporally averaged SFS field at desired heights [nHeights, nDim * 2]
-  ArrayType d_sfsBarAvg_;
-
-  //! Spatially averaged instantaneous temperature field [nHeights]
-  ArrayType d_thetaAvg_;
-
-  //! Spatially and temporally averaged temperature field [nHeights]
-  ArrayType d_thetaBarAvg_;
-
-  //! Spatially averaged instantaneous temperature SFS field
-  ArrayType d_thetaSFSAvg_;
-
-  //! Spatially averaged instantaneous temperature variance
-  ArrayType d_thetaUjAvg_;
-
-  //! Spatially and temporally averaged Temperature SFS field
-  ArrayType d_thetaSFSBarAvg_;
-
-  ArrayType d_thetaUjBarAvg_;
-
-  //! Spatially averaged temperature variance [nHeights]
-  ArrayType d_thetaVarAvg_;
-
-  //! Spatially and temporally averaged temperature variance [nHeights]
-  ArrayType d_thetaBarVarAvg_;
-
-  //! Total nodal volume at each height level used for volumetric averaging
-  ArrayType d_sumVol_;
-
-  //! Average density at each height level
-  ArrayType d_rhoAvg_;
-
-  //! Height from the wall
-  ArrayType d_heights_;
+  /** Offsets of each statistic within the packed per-height sums
+   *
+   *  Tensors are stored as the nDim * 2 unique components.
+   */
+  struct StatsLayout
+  {
+    int sumVol{0};
+    int rho{0};
+    int velMag{0};
+    int vel{0};
+    int velBar{0};
+    int uiuj{0};
+    int uiujBar{0};
+    int sfs{0};
+    int sfsBar{0};
+    int theta{0};
+    int thetaBar{0};
+    int thetaVar{0};
+    int thetaBarVar{0};
+    int thetaSFSBar{0};
+    int thetaUjBar{0};
+    int thetaUj{0};
+    int nComp{0};
+  };
+
+  //! Packed per-height sums of all statistics and their global reduction
+  std::unique_ptr<PlanarAveraging> averager_;
+
+  StatsLayout layout_;
 
   //! Spatially averaged instantaneous velocity at desired heights [nHeights, nDim]
   HostArrayType velAvg_;
@@ -298,6 +282,9 @@ private:
 
   //! Flag indicating whether initialization must be performed
   bool doInit_{true};
+
+  //! Flag indicating whether the averages reflect the latest accumulation
+  bool statsReady_{false};
 };
 
 }  // nalu
@@ -0,0 +1,81 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef PLANARAVERAGING_H
+#define PLANARAVERAGING_H
+
+#include "KokkosInterface.h"
+
+#include "stk_util/parallel/Parallel.hpp"
+
+namespace sierra {
+namespace nalu {
+
+/** Packed accumulator for height-binned (planar) averages
+ *
+ *  All statistics of all bins live in one contiguous device array of size
+ *  [nBins, nComp], so that a single kernel can accumulate every quantity and
+ *  a single MPI reduction makes the sums global. The reduction is posted as a
+ *  nonblocking MPI_Iallreduce and only completed when the caller needs the
+ *  result, letting it overlap the work that follows the accumulation.
+ */
+class PlanarAveraging
+{
+public:
+  using ArrayType = Kokkos::View<double*, Kokkos::LayoutRight, MemSpace>;
+  using HostArrayType = typename ArrayType::HostMirror;
+
+  PlanarAveraging(MPI_Comm comm, const int nBins, const int nComp);
+
+  ~PlanarAveraging();
+
+  //! Zero the device sums; completes any pending reduction first
+  void reset();
+
+  //! Device array [nBins * nComp] that the caller accumulates into
+  const ArrayType& device_sums() const { return d_sums_; }
+
+  //! Copy the local sums to host and post the global reduction
+  void start_reduction();
+
+  //! Wait for the global reduction; no-op when nothing is pending
+  void finish_reduction();
+
+  bool reduction_pending() const { return request_ != MPI_REQUEST_NULL; }
+
+  //! Globally reduced sum of component `comp` in bin `ib`
+  double sum(const int ib, const int comp) const
+  { return sums_(ib * nComp_ + comp); }
+
+  int num_bins() const { return nBins_; }
+  int num_components() const { return nComp_; }
+
+private:
+  PlanarAveraging() = delete;
+  PlanarAveraging(const PlanarAveraging&) = delete;
+
+  MPI_Comm comm_;
+
+  const int nBins_;
+  const int nComp_;
+
+  ArrayType d_sums_;
+
+  //! Host buffer reduced in place
+  HostArrayType sums_;
+
+  MPI_Request request_{MPI_REQUEST_NULL};
+};
+
+}  // nalu
+}  // sierra
+
+
+#endif /* PLANARAVERAGING_H */
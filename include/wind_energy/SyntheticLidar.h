@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <array>
+#include <fstream>
 
 namespace sierra {
 namespace nalu {
@@ -84,6 +85,60 @@ private:
 
 };
 
+class PointSampler;
+
+/** Scanning lidar whose beam follows the scan pattern in physical time
+ *
+ *  The beam is recomputed every time step and sampled at a set of range
+ *  gates. Each gate measures the line-of-sight velocity, averaged over the
+ *  gate with a triangular range weighting. The sample points move with the
+ *  beam, so their elements are found by walking from the previous step.
+ */
+class TimeResolvedLidar
+{
+public:
+  TimeResolvedLidar();
+  ~TimeResolvedLidar();
+
+  void load(const YAML::Node& node);
+
+  // locate the beam at the current time (after populate_mesh())
+  void initialize(stk::mesh::BulkData& bulk, const double time);
+
+  // move the beam, sample and append to the output file
+  void execute(const double time, const bool meshMoved);
+
+  // line-of-site velocity of each range gate at the last execute; the
+  // samples are only sent to rank 0, which writes the output
+  const std::vector<double>& los_velocity() const { return losVelocity_; }
+
+  const PointSampler& sampler() const { return *sampler_; }
+
+private:
+  void beam_points(const double time, std::vector<double>& coords);
+
+  SpinnerLidarSegmentGenerator segGen_;
+
+  int ngates_{100};
+  double gateLength_{0.0};
+  int pointsPerGate_{1};
+  std::vector<std::string> fromTargetNames_;
+  std::string name_{"lidar_line"};
+
+  // offsets and weights of the points within a range gate
+  std::vector<double> gateOffsets_;
+  std::vector<double> gateWeights_;
+
+  Segment segment_;
+  std::vector<double> gateCenters_;
+  const stk::mesh::FieldBase* velocityField_{nullptr};
+  std::unique_ptr<PointSampler> sampler_;
+  std::vector<double> beamCoords_;
+  std::vector<double> velocity_;
+  std::vector<double> losVelocity_;
+  std::ofstream outputFile_;
+};
+
 
 
 }
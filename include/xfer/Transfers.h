@@ -25,6 +25,7 @@ class Node;
 namespace sierra{
 namespace nalu{
 
+class Realm;
 class Simulation;
 class Transfer;
 
@@ -36,12 +37,17 @@ public:
   void load(const YAML::Node & node);
   void breadboard();
   void initialize();
+  // search and ghost again for the transfers from or to a rebalanced realm
+  void reinitialize(const Realm& realm);
   void execute(); // general method to execute all xfers (as apposed to Realm)
   Simulation *root();
   Simulation *parent();
 
   Simulation &simulation_;
   std::vector<Transfer *> transferVector_;
+
+private:
+  static void initialize(const std::vector<Transfer *>& transfers);
 };
 
 } // namespace nalu